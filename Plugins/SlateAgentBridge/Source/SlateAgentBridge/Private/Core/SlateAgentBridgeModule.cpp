@@ -56,7 +56,7 @@ void FSlateAgentBridgeModule::StartupModule()
         }
     }
 
-    LiveCodingManager = MakeUnique<FSlateAgentBridgeLiveCodingManager>();
+    LiveCodingManager = MakeShared<FSlateAgentBridgeLiveCodingManager>();
     LiveCodingManager->Initialize();
 
     if (StartMcpServer())
@@ -102,7 +102,7 @@ bool FSlateAgentBridgeModule::StartMcpServer()
         return true;
     }
 
-    McpServer = MakeUnique<FSlateAgentBridgeMcpServer>(*LiveCodingManager, McpServerPort, McpBindAddress);
+    McpServer = MakeUnique<FSlateAgentBridgeMcpServer>(LiveCodingManager.ToSharedRef(), McpServerPort, McpBindAddress);
     if (!McpServer->Start())
     {
         McpServer.Reset();
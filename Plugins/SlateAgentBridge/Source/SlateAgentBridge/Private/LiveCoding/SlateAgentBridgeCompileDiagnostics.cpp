@@ -0,0 +1,199 @@
+#include "LiveCoding/SlateAgentBridgeCompileDiagnostics.h"
+
+#include "Internationalization/Regex.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+
+namespace
+{
+	/** C:\Path\File.cpp(12): error C2065: msg   and   File.cpp(12,5): warning C4996: msg */
+	const FRegexPattern& GetMsvcPattern()
+	{
+		static const FRegexPattern Pattern(TEXT("^\\s*(.+?)\\((\\d+)(?:,(\\d+))?\\)\\s*:\\s*(fatal error|error|warning|note)\\s*([A-Z]+\\d+)?\\s*:\\s*(.*)$"));
+		return Pattern;
+	}
+
+	/** /path/File.cpp:12:5: error: msg [-Wflag] */
+	const FRegexPattern& GetClangPattern()
+	{
+		static const FRegexPattern Pattern(TEXT("^\\s*(.+?):(\\d+):(\\d+):\\s*(fatal error|error|warning|note):\\s*(.*?)(?:\\s*\\[(-W[^\\]]+)\\])?\\s*$"));
+		return Pattern;
+	}
+
+	/** Module.obj : error LNK2019: msg   and   LINK : fatal error LNK1120: msg */
+	const FRegexPattern& GetLinkerPattern()
+	{
+		static const FRegexPattern Pattern(TEXT("^\\s*(.+?)\\s*:\\s*(fatal error|error|warning)\\s+(LNK\\d+)\\s*:\\s*(.*)$"));
+		return Pattern;
+	}
+
+	FString NormalizeSeverity(const FString& Severity)
+	{
+		return Severity == TEXT("fatal error") ? FString(TEXT("fatal")) : Severity;
+	}
+
+	FString NormalizeFile(FString File)
+	{
+		File.TrimStartAndEndInline();
+		FPaths::NormalizeFilename(File);
+		return File;
+	}
+}
+
+void FSlateAgentBridgeCompileDiagnostics::CommitCompile(const TArray<FSlateAgentBridgeLogEntry>& Entries)
+{
+	TArray<FSlateAgentBridgeDiagnostic> Parsed;
+	TMap<FString, TArray<int32>> ParsedIndex;
+	TSet<FString> SeenKeys;
+
+	for (const FSlateAgentBridgeLogEntry& Entry : Entries)
+	{
+		// Cheap rejection before running the regexes; every supported format has one of these.
+		if (!Entry.Message.Contains(TEXT("error")) && !Entry.Message.Contains(TEXT("warning")) && !Entry.Message.Contains(TEXT("note")))
+		{
+			continue;
+		}
+
+		FSlateAgentBridgeDiagnostic Diagnostic;
+		if (!ParseLine(Entry.Message, Diagnostic))
+		{
+			continue;
+		}
+
+		const FString Key = FString::Printf(TEXT("%s|%d|%d|%s|%s|%s"), *Diagnostic.File, Diagnostic.Line, Diagnostic.Column, *Diagnostic.Severity, *Diagnostic.Code, *Diagnostic.Message);
+		bool bAlreadySeen = false;
+		SeenKeys.Add(Key, &bAlreadySeen);
+		if (bAlreadySeen)
+		{
+			continue;
+		}
+
+		ParsedIndex.FindOrAdd(Diagnostic.File).Add(Parsed.Num());
+		Parsed.Add(MoveTemp(Diagnostic));
+	}
+
+	FScopeLock Guard(&Mutex);
+	Diagnostics = MoveTemp(Parsed);
+	FileIndex = MoveTemp(ParsedIndex);
+}
+
+void FSlateAgentBridgeCompileDiagnostics::Query(const FString& FileFilter, const FString& Severity, int32 MaxCount, TArray<FSlateAgentBridgeFileDiagnostics>& OutFiles, int32& OutTotalMatches) const
+{
+	FScopeLock Guard(&Mutex);
+
+	OutFiles.Reset();
+	OutTotalMatches = 0;
+
+	const FString NormalizedFilter = FileFilter.IsEmpty() ? FString() : NormalizeFile(FileFilter);
+	int32 Returned = 0;
+
+	for (const TPair<FString, TArray<int32>>& Pair : FileIndex)
+	{
+		if (!NormalizedFilter.IsEmpty() && !Pair.Key.Contains(NormalizedFilter))
+		{
+			continue;
+		}
+
+		FSlateAgentBridgeFileDiagnostics* FileEntry = nullptr;
+		for (const int32 DiagnosticIndex : Pair.Value)
+		{
+			const FSlateAgentBridgeDiagnostic& Diagnostic = Diagnostics[DiagnosticIndex];
+			if (!Severity.IsEmpty() && !Diagnostic.Severity.Equals(Severity, ESearchCase::IgnoreCase))
+			{
+				continue;
+			}
+
+			++OutTotalMatches;
+			if (Returned >= MaxCount)
+			{
+				continue;
+			}
+
+			if (!FileEntry)
+			{
+				FileEntry = &OutFiles.AddDefaulted_GetRef();
+				FileEntry->File = Pair.Key;
+			}
+			FileEntry->Diagnostics.Add(Diagnostic);
+			++Returned;
+		}
+	}
+}
+
+void FSlateAgentBridgeCompileDiagnostics::GetCounts(int32& OutErrors, int32& OutWarnings, int32& OutNotes) const
+{
+	FScopeLock Guard(&Mutex);
+
+	OutErrors = 0;
+	OutWarnings = 0;
+	OutNotes = 0;
+	for (const FSlateAgentBridgeDiagnostic& Diagnostic : Diagnostics)
+	{
+		if (Diagnostic.Severity == TEXT("warning"))
+		{
+			++OutWarnings;
+		}
+		else if (Diagnostic.Severity == TEXT("note"))
+		{
+			++OutNotes;
+		}
+		else
+		{
+			++OutErrors;
+		}
+	}
+}
+
+void FSlateAgentBridgeCompileDiagnostics::Reset()
+{
+	FScopeLock Guard(&Mutex);
+	Diagnostics.Reset();
+	FileIndex.Reset();
+}
+
+bool FSlateAgentBridgeCompileDiagnostics::ParseLine(const FString& Line, FSlateAgentBridgeDiagnostic& OutDiagnostic)
+{
+	{
+		FRegexMatcher Matcher(GetMsvcPattern(), Line);
+		if (Matcher.FindNext())
+		{
+			OutDiagnostic.File = NormalizeFile(Matcher.GetCaptureGroup(1));
+			OutDiagnostic.Line = FCString::Atoi(*Matcher.GetCaptureGroup(2));
+			OutDiagnostic.Column = FCString::Atoi(*Matcher.GetCaptureGroup(3));
+			OutDiagnostic.Severity = NormalizeSeverity(Matcher.GetCaptureGroup(4));
+			OutDiagnostic.Code = Matcher.GetCaptureGroup(5);
+			OutDiagnostic.Message = Matcher.GetCaptureGroup(6).TrimEnd();
+			return true;
+		}
+	}
+
+	{
+		FRegexMatcher Matcher(GetClangPattern(), Line);
+		if (Matcher.FindNext())
+		{
+			OutDiagnostic.File = NormalizeFile(Matcher.GetCaptureGroup(1));
+			OutDiagnostic.Line = FCString::Atoi(*Matcher.GetCaptureGroup(2));
+			OutDiagnostic.Column = FCString::Atoi(*Matcher.GetCaptureGroup(3));
+			OutDiagnostic.Severity = NormalizeSeverity(Matcher.GetCaptureGroup(4));
+			OutDiagnostic.Message = Matcher.GetCaptureGroup(5);
+			OutDiagnostic.Code = Matcher.GetCaptureGroup(6);
+			return true;
+		}
+	}
+
+	{
+		FRegexMatcher Matcher(GetLinkerPattern(), Line);
+		if (Matcher.FindNext())
+		{
+			OutDiagnostic.File = NormalizeFile(Matcher.GetCaptureGroup(1));
+			OutDiagnostic.Line = 0;
+			OutDiagnostic.Column = 0;
+			OutDiagnostic.Severity = NormalizeSeverity(Matcher.GetCaptureGroup(2));
+			OutDiagnostic.Code = Matcher.GetCaptureGroup(3);
+			OutDiagnostic.Message = Matcher.GetCaptureGroup(4).TrimEnd();
+			return true;
+		}
+	}
+
+	return false;
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SlateAgentBridgeLiveCodingTypes.h"
+
+#include "HAL/CriticalSection.h"
+
+/** One compiler or linker diagnostic. Line and Column are 0 when the tool did not report them. */
+struct FSlateAgentBridgeDiagnostic
+{
+	FString File;
+	int32 Line = 0;
+	int32 Column = 0;
+
+	/** fatal, error, warning or note. */
+	FString Severity;
+
+	/** MSVC/linker code (C2065, LNK2019) or Clang warning flag (-Wunused-variable); may be empty. */
+	FString Code;
+	FString Message;
+};
+
+/** Diagnostics of one file, in the order they were first reported. */
+struct FSlateAgentBridgeFileDiagnostics
+{
+	FString File;
+	TArray<FSlateAgentBridgeDiagnostic> Diagnostics;
+};
+
+/**
+ * Structured diagnostics of the most recent compile. MSVC and Clang output is parsed once when a
+ * compile's log is committed; duplicates (the same diagnostic reported by several translation
+ * units) are dropped and the rest are indexed by file.
+ */
+class FSlateAgentBridgeCompileDiagnostics
+{
+public:
+	/** Parses the compile's log lines and replaces the previous compile's diagnostics. */
+	void CommitCompile(const TArray<FSlateAgentBridgeLogEntry>& Entries);
+
+	/**
+	 * Collects diagnostics grouped by file. FileFilter matches any file whose path contains it and
+	 * Severity restricts to one severity; both are ignored when empty. At most MaxCount diagnostics
+	 * are returned; OutTotalMatches counts every match.
+	 */
+	void Query(const FString& FileFilter, const FString& Severity, int32 MaxCount, TArray<FSlateAgentBridgeFileDiagnostics>& OutFiles, int32& OutTotalMatches) const;
+
+	/** Number of retained diagnostics per severity. */
+	void GetCounts(int32& OutErrors, int32& OutWarnings, int32& OutNotes) const;
+
+	void Reset();
+
+	/** Parses one MSVC, Clang or linker diagnostic line. */
+	static bool ParseLine(const FString& Line, FSlateAgentBridgeDiagnostic& OutDiagnostic);
+
+private:
+	mutable FCriticalSection Mutex;
+	TArray<FSlateAgentBridgeDiagnostic> Diagnostics;
+
+	/** File path -> indices into Diagnostics, in first-seen order of files. */
+	TMap<FString, TArray<int32>> FileIndex;
+};
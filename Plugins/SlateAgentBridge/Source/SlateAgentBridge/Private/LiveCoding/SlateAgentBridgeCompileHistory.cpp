@@ -0,0 +1,232 @@
+#include "LiveCoding/SlateAgentBridgeCompileHistory.h"
+
+#include "SlateAgentBridgeLog.h"
+
+#include "Async/Async.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+
+namespace SlateAgentBridge
+{
+	static constexpr const TCHAR* CompileHistoryHeader = TEXT("# SlateAgentBridge compile history v1: startUtc durationMs result logLines errors warnings moduleDetectionMs compileLinkMs patchLoadMs");
+	static constexpr int32 CompileHistoryFieldCount = 9;
+}
+
+namespace
+{
+	bool MessageContainsAny(const FString& Message, std::initializer_list<const TCHAR*> Markers)
+	{
+		for (const TCHAR* Marker : Markers)
+		{
+			if (Message.Contains(Marker, ESearchCase::IgnoreCase))
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	int64 SecondsToMilliseconds(double Seconds)
+	{
+		return Seconds < 0.0 ? -1 : FMath::RoundToInt64(Seconds * 1000.0);
+	}
+
+	double MillisecondsToSeconds(int64 Milliseconds)
+	{
+		return Milliseconds < 0 ? -1.0 : static_cast<double>(Milliseconds) / 1000.0;
+	}
+}
+
+FSlateAgentBridgeCompileHistory::FSlateAgentBridgeCompileHistory(int32 InMaxRecords)
+	: MaxRecords(FMath::Max(1, InMaxRecords))
+	, SaveState(MakeShared<FSaveState, ESPMode::ThreadSafe>())
+{
+}
+
+void FSlateAgentBridgeCompileHistory::Initialize(int32 InMaxRecords)
+{
+	TArray<FString> Lines;
+	FFileHelper::LoadFileToStringArray(Lines, *GetHistoryFilePath());
+
+	TArray<FSlateAgentBridgeCompileRecord> Loaded;
+	Loaded.Reserve(Lines.Num());
+	for (const FString& Line : Lines)
+	{
+		FSlateAgentBridgeCompileRecord Record;
+		if (!Line.StartsWith(TEXT("#")) && ParseRecord(Line, Record))
+		{
+			Loaded.Add(MoveTemp(Record));
+		}
+	}
+
+	FScopeLock Guard(&Mutex);
+	MaxRecords = FMath::Max(1, InMaxRecords);
+	Records = MoveTemp(Loaded);
+	if (Records.Num() > MaxRecords)
+	{
+		Records.RemoveAt(0, Records.Num() - MaxRecords);
+	}
+
+	UE_LOG(LogSlateAgentBridge, Verbose, TEXT("Loaded %d Live Coding compile history records."), Records.Num());
+}
+
+void FSlateAgentBridgeCompileHistory::Record(const FDateTime& StartUtc, const FDateTime& EndUtc, const FString& Result, const TArray<FSlateAgentBridgeLogEntry>& CapturedEntries)
+{
+	FSlateAgentBridgeCompileRecord Record;
+	Record.StartUtc = StartUtc;
+	Record.EndUtc = EndUtc;
+	Record.DurationSeconds = FMath::Max(0.0, (EndUtc - StartUtc).GetTotalSeconds());
+	Record.Result = Result;
+	Record.LogLines = CapturedEntries.Num();
+
+	for (const FSlateAgentBridgeLogEntry& Entry : CapturedEntries)
+	{
+		if (Entry.Verbosity.Equals(TEXT("Error"), ESearchCase::IgnoreCase) || Entry.Message.Contains(TEXT(": error "), ESearchCase::IgnoreCase))
+		{
+			++Record.ErrorCount;
+		}
+		else if (Entry.Verbosity.Equals(TEXT("Warning"), ESearchCase::IgnoreCase) || Entry.Message.Contains(TEXT(": warning "), ESearchCase::IgnoreCase))
+		{
+			++Record.WarningCount;
+		}
+	}
+
+	DerivePhaseTimings(StartUtc, EndUtc, CapturedEntries, Record);
+
+	{
+		FScopeLock Guard(&Mutex);
+		Records.Add(MoveTemp(Record));
+		if (Records.Num() > MaxRecords)
+		{
+			Records.RemoveAt(0, Records.Num() - MaxRecords, EAllowShrinking::No);
+		}
+	}
+
+	SaveAsync();
+}
+
+void FSlateAgentBridgeCompileHistory::GetRecent(int32 MaxCount, TArray<FSlateAgentBridgeCompileRecord>& OutRecords, int32& OutTotalRecords) const
+{
+	FScopeLock Guard(&Mutex);
+
+	OutTotalRecords = Records.Num();
+	const int32 Count = FMath::Clamp(MaxCount, 0, Records.Num());
+	OutRecords.Reset(Count);
+	for (int32 Index = Records.Num() - 1; Index >= Records.Num() - Count; --Index)
+	{
+		OutRecords.Add(Records[Index]);
+	}
+}
+
+FString FSlateAgentBridgeCompileHistory::GetHistoryFilePath()
+{
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("SlateAgentBridge"), TEXT("CompileHistory.tsv"));
+}
+
+void FSlateAgentBridgeCompileHistory::DerivePhaseTimings(const FDateTime& StartUtc, const FDateTime& EndUtc, const TArray<FSlateAgentBridgeLogEntry>& CapturedEntries, FSlateAgentBridgeCompileRecord& OutRecord)
+{
+	// Live Coding does not report phase boundaries, so they are taken from the first log line of
+	// each phase: module detection runs until the compiler starts, compile and link until the
+	// patch is loaded, and patch load until the compile is finalized.
+	const FSlateAgentBridgeLogEntry* CompileStart = nullptr;
+	const FSlateAgentBridgeLogEntry* PatchLoadStart = nullptr;
+
+	for (const FSlateAgentBridgeLogEntry& Entry : CapturedEntries)
+	{
+		if (!CompileStart)
+		{
+			if (MessageContainsAny(Entry.Message, { TEXT("Compiling"), TEXT("Building patch"), TEXT("Creating patch") }))
+			{
+				CompileStart = &Entry;
+			}
+		}
+		else if (MessageContainsAny(Entry.Message, { TEXT("Loading patch"), TEXT("Loading module"), TEXT("Patching") }))
+		{
+			PatchLoadStart = &Entry;
+			break;
+		}
+	}
+
+	if (!CompileStart)
+	{
+		return;
+	}
+
+	OutRecord.ModuleDetectionSeconds = FMath::Max(0.0, (CompileStart->Timestamp - StartUtc).GetTotalSeconds());
+
+	const FDateTime CompileEnd = PatchLoadStart ? PatchLoadStart->Timestamp : EndUtc;
+	OutRecord.CompileLinkSeconds = FMath::Max(0.0, (CompileEnd - CompileStart->Timestamp).GetTotalSeconds());
+
+	if (PatchLoadStart)
+	{
+		OutRecord.PatchLoadSeconds = FMath::Max(0.0, (EndUtc - PatchLoadStart->Timestamp).GetTotalSeconds());
+	}
+}
+
+FString FSlateAgentBridgeCompileHistory::SerializeRecord(const FSlateAgentBridgeCompileRecord& Record)
+{
+	return FString::Printf(TEXT("%s\t%lld\t%s\t%d\t%d\t%d\t%lld\t%lld\t%lld"),
+		*Record.StartUtc.ToIso8601(),
+		SecondsToMilliseconds(Record.DurationSeconds),
+		*Record.Result,
+		Record.LogLines,
+		Record.ErrorCount,
+		Record.WarningCount,
+		SecondsToMilliseconds(Record.ModuleDetectionSeconds),
+		SecondsToMilliseconds(Record.CompileLinkSeconds),
+		SecondsToMilliseconds(Record.PatchLoadSeconds));
+}
+
+bool FSlateAgentBridgeCompileHistory::ParseRecord(const FString& Line, FSlateAgentBridgeCompileRecord& OutRecord)
+{
+	TArray<FString> Fields;
+	Line.ParseIntoArray(Fields, TEXT("\t"), false);
+	if (Fields.Num() != SlateAgentBridge::CompileHistoryFieldCount || !FDateTime::ParseIso8601(*Fields[0], OutRecord.StartUtc))
+	{
+		return false;
+	}
+
+	OutRecord.DurationSeconds = MillisecondsToSeconds(FCString::Atoi64(*Fields[1]));
+	OutRecord.EndUtc = OutRecord.StartUtc + FTimespan::FromSeconds(FMath::Max(0.0, OutRecord.DurationSeconds));
+	OutRecord.Result = Fields[2];
+	OutRecord.LogLines = FCString::Atoi(*Fields[3]);
+	OutRecord.ErrorCount = FCString::Atoi(*Fields[4]);
+	OutRecord.WarningCount = FCString::Atoi(*Fields[5]);
+	OutRecord.ModuleDetectionSeconds = MillisecondsToSeconds(FCString::Atoi64(*Fields[6]));
+	OutRecord.CompileLinkSeconds = MillisecondsToSeconds(FCString::Atoi64(*Fields[7]));
+	OutRecord.PatchLoadSeconds = MillisecondsToSeconds(FCString::Atoi64(*Fields[8]));
+	return true;
+}
+
+void FSlateAgentBridgeCompileHistory::SaveAsync()
+{
+	FString Contents;
+	uint64 Generation = 0;
+	{
+		FScopeLock Guard(&Mutex);
+		Contents.Reserve((Records.Num() + 1) * 96);
+		Contents += SlateAgentBridge::CompileHistoryHeader;
+		Contents += TEXT("\n");
+		for (const FSlateAgentBridgeCompileRecord& Record : Records)
+		{
+			Contents += SerializeRecord(Record);
+			Contents += TEXT("\n");
+		}
+		Generation = ++SaveGeneration;
+	}
+
+	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [State = SaveState, Contents = MoveTemp(Contents), Generation]()
+	{
+		FScopeLock WriteGuard(&State->WriteMutex);
+		if (Generation <= State->WrittenGeneration)
+		{
+			return;
+		}
+
+		if (FFileHelper::SaveStringToFile(Contents, *GetHistoryFilePath(), FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+		{
+			State->WrittenGeneration = Generation;
+		}
+	});
+}
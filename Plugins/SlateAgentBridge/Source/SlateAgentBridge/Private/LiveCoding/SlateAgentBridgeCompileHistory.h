@@ -0,0 +1,61 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SlateAgentBridgeLiveCodingTypes.h"
+
+#include "HAL/CriticalSection.h"
+
+/** Summary of one finished compile. Phase timings are negative when the log did not reveal them. */
+struct FSlateAgentBridgeCompileRecord
+{
+	FDateTime StartUtc;
+	FDateTime EndUtc;
+	double DurationSeconds = 0.0;
+	FString Result;
+	int32 LogLines = 0;
+	int32 ErrorCount = 0;
+	int32 WarningCount = 0;
+	double ModuleDetectionSeconds = -1.0;
+	double CompileLinkSeconds = -1.0;
+	double PatchLoadSeconds = -1.0;
+};
+
+/**
+ * Size-bounded history of Live Coding compiles, persisted as one tab-separated line per compile
+ * under Saved/SlateAgentBridge so compile times can be compared across editor sessions.
+ */
+class FSlateAgentBridgeCompileHistory
+{
+public:
+	explicit FSlateAgentBridgeCompileHistory(int32 InMaxRecords = 500);
+
+	/** Sets the retention cap and loads any history written by earlier sessions. */
+	void Initialize(int32 InMaxRecords);
+
+	/** Builds a record from the compile's captured log, retains it and saves the file in the background. */
+	void Record(const FDateTime& StartUtc, const FDateTime& EndUtc, const FString& Result, const TArray<FSlateAgentBridgeLogEntry>& CapturedEntries);
+
+	/** Copies the newest MaxCount records, newest first. */
+	void GetRecent(int32 MaxCount, TArray<FSlateAgentBridgeCompileRecord>& OutRecords, int32& OutTotalRecords) const;
+
+	static FString GetHistoryFilePath();
+
+private:
+	static void DerivePhaseTimings(const FDateTime& StartUtc, const FDateTime& EndUtc, const TArray<FSlateAgentBridgeLogEntry>& CapturedEntries, FSlateAgentBridgeCompileRecord& OutRecord);
+	static FString SerializeRecord(const FSlateAgentBridgeCompileRecord& Record);
+	static bool ParseRecord(const FString& Line, FSlateAgentBridgeCompileRecord& OutRecord);
+	void SaveAsync();
+
+	/** Shared with background writes so a stale snapshot never overwrites a newer one. */
+	struct FSaveState
+	{
+		FCriticalSection WriteMutex;
+		uint64 WrittenGeneration = 0;
+	};
+
+	mutable FCriticalSection Mutex;
+	TArray<FSlateAgentBridgeCompileRecord> Records;
+	int32 MaxRecords;
+	uint64 SaveGeneration = 0;
+	TSharedRef<FSaveState, ESPMode::ThreadSafe> SaveState;
+};
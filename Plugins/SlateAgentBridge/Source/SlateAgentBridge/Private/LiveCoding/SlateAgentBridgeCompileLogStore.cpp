@@ -0,0 +1,96 @@
+#include "LiveCoding/SlateAgentBridgeCompileLogStore.h"
+
+#include "Misc/ScopeLock.h"
+
+FSlateAgentBridgeCompileLogStore::FSlateAgentBridgeCompileLogStore(int32 InMaxLines, int64 InMaxBytes)
+	: MaxLines(FMath::Max(1, InMaxLines))
+	, MaxBytes(FMath::Max<int64>(1, InMaxBytes))
+{
+}
+
+void FSlateAgentBridgeCompileLogStore::SetLimits(int32 InMaxLines, int64 InMaxBytes)
+{
+	FScopeLock Guard(&Mutex);
+	MaxLines = FMath::Max(1, InMaxLines);
+	MaxBytes = FMath::Max<int64>(1, InMaxBytes);
+}
+
+void FSlateAgentBridgeCompileLogStore::CommitCompile(TArray<FSlateAgentBridgeLogEntry>&& NewEntries)
+{
+	// Sequences are reserved up front; dropped lines still consume numbers so a cursor from the
+	// previous compile can tell that something was skipped.
+	int32 Limit = 0;
+	int64 ByteLimit = 0;
+	uint64 FirstSequence = 0;
+	{
+		FScopeLock Guard(&Mutex);
+		Limit = MaxLines;
+		ByteLimit = MaxBytes;
+		FirstSequence = NextSequence;
+		NextSequence += NewEntries.Num();
+	}
+
+	// The tail of a build log (errors, link result, patch status) is the useful part, so the
+	// oldest lines are the ones discarded when a compile exceeds the caps.
+	int32 FirstKept = FMath::Max(0, NewEntries.Num() - Limit);
+	int64 RetainedBytes = 0;
+	for (int32 Index = NewEntries.Num() - 1; Index >= FirstKept; --Index)
+	{
+		const int64 EntryBytes = GetEntryBytes(NewEntries[Index]);
+		if (RetainedBytes + EntryBytes > ByteLimit && Index < NewEntries.Num() - 1)
+		{
+			FirstKept = Index + 1;
+			break;
+		}
+		RetainedBytes += EntryBytes;
+	}
+
+	TArray<TSharedRef<const FSlateAgentBridgeLogEntry>> Committed;
+	Committed.Reserve(NewEntries.Num() - FirstKept);
+	for (int32 Index = FirstKept; Index < NewEntries.Num(); ++Index)
+	{
+		NewEntries[Index].Sequence = FirstSequence + Index;
+		Committed.Add(MakeShared<FSlateAgentBridgeLogEntry>(MoveTemp(NewEntries[Index])));
+	}
+
+	FScopeLock Guard(&Mutex);
+	Entries = MoveTemp(Committed);
+	DroppedLines = FirstKept;
+}
+
+void FSlateAgentBridgeCompileLogStore::CollectSince(uint64 SinceSequence, FSlateAgentBridgeCompileLogSlice& OutSlice) const
+{
+	FScopeLock Guard(&Mutex);
+
+	OutSlice.Entries.Reset();
+	OutSlice.LatestSequence = NextSequence - 1;
+	OutSlice.DroppedLines = DroppedLines;
+	OutSlice.bMissedEntries = false;
+
+	if (Entries.IsEmpty())
+	{
+		OutSlice.bMissedEntries = SinceSequence > 0 && SinceSequence < OutSlice.LatestSequence;
+		return;
+	}
+
+	const uint64 OldestSequence = Entries[0]->Sequence;
+	OutSlice.bMissedEntries = SinceSequence > 0 && SinceSequence + 1 < OldestSequence;
+
+	const int64 FirstIndex = SinceSequence < OldestSequence ? 0 : static_cast<int64>(SinceSequence - OldestSequence + 1);
+	if (FirstIndex < Entries.Num())
+	{
+		OutSlice.Entries.Append(Entries.GetData() + FirstIndex, Entries.Num() - static_cast<int32>(FirstIndex));
+	}
+}
+
+void FSlateAgentBridgeCompileLogStore::Reset()
+{
+	FScopeLock Guard(&Mutex);
+	Entries.Reset();
+	DroppedLines = 0;
+}
+
+int64 FSlateAgentBridgeCompileLogStore::GetEntryBytes(const FSlateAgentBridgeLogEntry& Entry)
+{
+	return sizeof(FSlateAgentBridgeLogEntry) + Entry.Message.GetAllocatedSize() + Entry.Category.GetAllocatedSize() + Entry.Verbosity.GetAllocatedSize();
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SlateAgentBridgeLiveCodingTypes.h"
+
+#include "HAL/CriticalSection.h"
+
+/** Entries newer than a caller's cursor, shared with the store rather than copied. */
+struct FSlateAgentBridgeCompileLogSlice
+{
+	TArray<TSharedRef<const FSlateAgentBridgeLogEntry>> Entries;
+
+	/** Sequence of the newest retained entry; pass it back as the next cursor. */
+	uint64 LatestSequence = 0;
+
+	/** True when entries after the cursor were already evicted or belonged to an older compile. */
+	bool bMissedEntries = false;
+
+	/** Lines of the last compile that were discarded to stay within the retention caps. */
+	int32 DroppedLines = 0;
+};
+
+/**
+ * Bounded, sequence-numbered log of the most recent Live Coding compile. Sequence numbers keep
+ * increasing across compiles, so a status poll can pass the last sequence it saw and receive
+ * only newer lines. Entries are immutable once committed and handed out by reference.
+ */
+class FSlateAgentBridgeCompileLogStore
+{
+public:
+	explicit FSlateAgentBridgeCompileLogStore(int32 InMaxLines = 2000, int64 InMaxBytes = 1024 * 1024);
+
+	void SetLimits(int32 InMaxLines, int64 InMaxBytes);
+
+	/** Replaces the retained log with the lines of a finished compile, keeping the newest ones within the caps. */
+	void CommitCompile(TArray<FSlateAgentBridgeLogEntry>&& Entries);
+
+	/** Collects every retained entry with a sequence greater than SinceSequence. */
+	void CollectSince(uint64 SinceSequence, FSlateAgentBridgeCompileLogSlice& OutSlice) const;
+
+	void Reset();
+
+private:
+	static int64 GetEntryBytes(const FSlateAgentBridgeLogEntry& Entry);
+
+	mutable FCriticalSection Mutex;
+	TArray<TSharedRef<const FSlateAgentBridgeLogEntry>> Entries;
+	int32 MaxLines;
+	int64 MaxBytes;
+	int32 DroppedLines = 0;
+	uint64 NextSequence = 1;
+};
@@ -2,45 +2,147 @@
 
 #include "Logging/LogVerbosity.h"
 #include "Misc/DateTime.h"
+#include "Misc/OutputDeviceRedirector.h"
 
-FSlateAgentBridgeLiveCodingLogCapture::FSlateAgentBridgeLiveCodingLogCapture() = default;
+FSlateAgentBridgeLiveCodingLogCapture::FSlateAgentBridgeLiveCodingLogCapture()
+	: Slots(MakeUnique<FSlot[]>(RingCapacity))
+	, WriteCursor(0)
+	, DroppedCount(0)
+	, bIsCapturing(false)
+{
+	// Categories emitted by the Live Coding module and its console; matched by FName only.
+	CapturedCategories.Add(FName(TEXT("LogLiveCoding")));
+	CapturedCategories.Add(FName(TEXT("LiveCoding")));
+	CapturedCategories.Add(FName(TEXT("LiveCodingConsole")));
+	CapturedCategories.Add(FName(TEXT("LogLiveCodingServer")));
 
-void FSlateAgentBridgeLiveCodingLogCapture::StartCapture()
+	for (uint64 Index = 0; Index < RingCapacity; ++Index)
+	{
+		Slots[Index].Sequence.Store(Index);
+	}
+}
+
+FSlateAgentBridgeLiveCodingLogCapture::~FSlateAgentBridgeLiveCodingLogCapture()
 {
-	FScopeLock CaptureLock(&CaptureMutex);
-	CapturedEntries.Reset();
-	bIsCapturing = true;
+	bIsCapturing.Store(false);
+	Detach();
 }
 
-TArray<FSlateAgentBridgeLogEntry> FSlateAgentBridgeLiveCodingLogCapture::StopCapture()
+void FSlateAgentBridgeLiveCodingLogCapture::StartCapture()
 {
-	FScopeLock CaptureLock(&CaptureMutex);
-	bIsCapturing = false;
-	return MoveTemp(CapturedEntries);
+	// Discard anything left over from a capture that was never stopped.
+	DrainPending();
+	DrainedEntries.Reset();
+	DroppedCount.Store(0);
+	bIsCapturing.Store(true);
+
+	if (!bAttached && GLog)
+	{
+		GLog->AddOutputDevice(this);
+		bAttached = true;
+	}
 }
 
-void FSlateAgentBridgeLiveCodingLogCapture::Serialize(const TCHAR* V, ELogVerbosity::Type Verbosity, const FName& Category)
+TConstArrayView<FSlateAgentBridgeLogEntry> FSlateAgentBridgeLiveCodingLogCapture::DrainPending()
 {
-	if (Category.IsNone())
+	for (;;)
 	{
-		return;
+		FSlot& Slot = Slots[ReadCursor & (RingCapacity - 1)];
+		if (Slot.Sequence.Load() != ReadCursor + 1)
+		{
+			break;
+		}
+
+		DrainedEntries.Add(MoveTemp(Slot.Entry));
+		Slot.Entry = FSlateAgentBridgeLogEntry();
+		Slot.Sequence.Store(ReadCursor + RingCapacity);
+		++ReadCursor;
 	}
 
-	const FString CategoryString = Category.ToString();
-	if (!CategoryString.Contains(TEXT("LiveCoding")))
+	return DrainedEntries;
+}
+
+TArray<FSlateAgentBridgeLogEntry> FSlateAgentBridgeLiveCodingLogCapture::StopCapture()
+{
+	bIsCapturing.Store(false);
+	Detach();
+	DrainPending();
+
+	const uint32 Dropped = DroppedCount.Exchange(0);
+	if (Dropped > 0)
 	{
-		return;
+		FSlateAgentBridgeLogEntry& Notice = DrainedEntries.AddDefaulted_GetRef();
+		Notice.Category = TEXT("LogSlateAgentBridge");
+		Notice.Verbosity = FString(::ToString(ELogVerbosity::Warning));
+		Notice.Message = FString::Printf(TEXT("%u Live Coding log lines were dropped because the capture buffer was full."), Dropped);
+		Notice.Timestamp = FDateTime::UtcNow();
 	}
 
-	FScopeLock CaptureLockInstance(&CaptureMutex);
-	if (!bIsCapturing)
+	return MoveTemp(DrainedEntries);
+}
+
+void FSlateAgentBridgeLiveCodingLogCapture::Serialize(const TCHAR* V, ELogVerbosity::Type Verbosity, const FName& Category)
+{
+	if (!bIsCapturing.Load(EMemoryOrder::Relaxed) || !IsCapturedCategory(Category))
 	{
 		return;
 	}
 
-	FSlateAgentBridgeLogEntry& NewEntry = CapturedEntries.AddDefaulted_GetRef();
-	NewEntry.Category = CategoryString;
+	FSlateAgentBridgeLogEntry NewEntry;
+	NewEntry.Category = Category.ToString();
 	NewEntry.Message = FString(V);
 	NewEntry.Verbosity = FString(::ToString(Verbosity));
 	NewEntry.Timestamp = FDateTime::UtcNow();
+
+	// Bounded MPSC queue: a producer claims a position only when its slot has been released by
+	// the consumer, so a full buffer drops the line instead of blocking the logging thread.
+	uint64 Position = WriteCursor.Load();
+	for (;;)
+	{
+		FSlot& Slot = Slots[Position & (RingCapacity - 1)];
+		const int64 Lag = static_cast<int64>(Slot.Sequence.Load() - Position);
+		if (Lag == 0)
+		{
+			if (WriteCursor.CompareExchange(Position, Position + 1))
+			{
+				Slot.Entry = MoveTemp(NewEntry);
+				Slot.Sequence.Store(Position + 1);
+				return;
+			}
+		}
+		else if (Lag < 0)
+		{
+			DroppedCount.IncrementExchange();
+			return;
+		}
+		else
+		{
+			Position = WriteCursor.Load();
+		}
+	}
+}
+
+bool FSlateAgentBridgeLiveCodingLogCapture::IsCapturedCategory(const FName& Category) const
+{
+	for (const FName& CapturedCategory : CapturedCategories)
+	{
+		if (Category == CapturedCategory)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void FSlateAgentBridgeLiveCodingLogCapture::Detach()
+{
+	if (bAttached)
+	{
+		if (GLog)
+		{
+			GLog->RemoveOutputDevice(this);
+		}
+		bAttached = false;
+	}
 }
@@ -3,27 +3,60 @@
 #include "CoreMinimal.h"
 #include "SlateAgentBridgeLiveCodingTypes.h"
 
-#include "HAL/CriticalSection.h"
-#include "Misc/ScopeLock.h"
 #include "Misc/OutputDevice.h"
+#include "Templates/Atomic.h"
 
 /**
  * Captures Live Coding logs while a compile is in-flight.
+ *
+ * The device is only attached to GLog between StartCapture and StopCapture. Lines are filtered
+ * by FName against a fixed set of Live Coding categories and pushed into a bounded lock-free
+ * ring buffer; logging threads are the producers and the game thread is the single consumer.
  */
 class FSlateAgentBridgeLiveCodingLogCapture : public FOutputDevice
 {
 public:
 	FSlateAgentBridgeLiveCodingLogCapture();
+	virtual ~FSlateAgentBridgeLiveCodingLogCapture() override;
 
+	/** Attaches to GLog and starts a new capture. Game thread only. */
 	void StartCapture();
+
+	/**
+	 * Moves lines out of the ring buffer so producers never see it full, and returns every line
+	 * drained since StartCapture. The view is valid until the next call. Game thread only.
+	 */
+	TConstArrayView<FSlateAgentBridgeLogEntry> DrainPending();
+
+	/** Detaches from GLog and returns every line captured since StartCapture. Game thread only. */
 	TArray<FSlateAgentBridgeLogEntry> StopCapture();
 
 	//~ Begin FOutputDevice Interface
 	virtual void Serialize(const TCHAR* V, ELogVerbosity::Type Verbosity, const FName& Category) override;
+	virtual bool CanBeUsedOnAnyThread() const override { return true; }
+	virtual bool CanBeUsedOnMultipleThreads() const override { return true; }
 	//~ End FOutputDevice Interface
 
 private:
-	FCriticalSection CaptureMutex;
-	bool bIsCapturing = false;
-	TArray<FSlateAgentBridgeLogEntry> CapturedEntries;
+	struct FSlot
+	{
+		/** Equals the slot's position when free and position + 1 once an entry is published. */
+		TAtomic<uint64> Sequence;
+		FSlateAgentBridgeLogEntry Entry;
+	};
+
+	static constexpr uint64 RingCapacity = 4096;
+	static_assert((RingCapacity & (RingCapacity - 1)) == 0, "Ring capacity must be a power of two.");
+
+	bool IsCapturedCategory(const FName& Category) const;
+	void Detach();
+
+	TArray<FName, TInlineAllocator<4>> CapturedCategories;
+	TUniquePtr<FSlot[]> Slots;
+	TAtomic<uint64> WriteCursor;
+	uint64 ReadCursor = 0;
+	TAtomic<uint32> DroppedCount;
+	TAtomic<bool> bIsCapturing;
+	bool bAttached = false;
+	TArray<FSlateAgentBridgeLogEntry> DrainedEntries;
 };
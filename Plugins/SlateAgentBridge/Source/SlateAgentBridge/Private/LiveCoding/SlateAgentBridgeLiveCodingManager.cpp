@@ -4,16 +4,31 @@
 #include "SlateAgentBridgeLog.h"
 
 #include "ILiveCodingModule.h"
+#include "Async/Async.h"
+#include "HAL/PlatformTime.h"
 #include "Logging/LogMacros.h"
-#include "Misc/OutputDeviceRedirector.h"
+#include "Misc/ConfigCacheIni.h"
 #include "Misc/ScopeLock.h"
 #include "Modules/ModuleManager.h"
 
+namespace SlateAgentBridge
+{
+	static constexpr const TCHAR* LiveCodingConfigSection = TEXT("/Script/SlateAgentBridge.SlateAgentBridgeSettings");
+	static constexpr const TCHAR* CompileLogMaxLinesKey = TEXT("CompileLogMaxLines");
+	static constexpr const TCHAR* CompileLogMaxBytesKey = TEXT("CompileLogMaxBytes");
+	static constexpr int32 DefaultCompileLogMaxLines = 2000;
+	static constexpr int32 DefaultCompileLogMaxBytes = 1024 * 1024;
+	static constexpr int32 MaxRetainedCompileRuns = 64;
+	static constexpr const TCHAR* CompileHistoryMaxRecordsKey = TEXT("CompileHistoryMaxRecords");
+	static constexpr int32 DefaultCompileHistoryMaxRecords = 500;
+}
+
 FSlateAgentBridgeLiveCodingManager::FSlateAgentBridgeLiveCodingManager()
 	: LastCompileTimestamp(FDateTime(0))
 	, LastCompileResult(ELiveCodingCompileResult::NotStarted)
 	, bHasCompileResult(false)
 	, bCompileInProgress(false)
+	, CompletedCompileCount(0)
 {
 }
 
@@ -27,15 +42,24 @@ void FSlateAgentBridgeLiveCodingManager::Initialize()
 	if (!LogCapture.IsValid())
 	{
 		LogCapture = MakeUnique<FSlateAgentBridgeLiveCodingLogCapture>();
-		if (GLog)
-		{
-			GLog->AddOutputDevice(LogCapture.Get());
-		}
 	}
 
+	int32 MaxLogLines = SlateAgentBridge::DefaultCompileLogMaxLines;
+	int32 MaxLogBytes = SlateAgentBridge::DefaultCompileLogMaxBytes;
+	int32 MaxHistoryRecords = SlateAgentBridge::DefaultCompileHistoryMaxRecords;
+	if (GConfig)
+	{
+		GConfig->GetInt(SlateAgentBridge::LiveCodingConfigSection, SlateAgentBridge::CompileHistoryMaxRecordsKey, MaxHistoryRecords, GEditorPerProjectIni);
+		GConfig->GetInt(SlateAgentBridge::LiveCodingConfigSection, SlateAgentBridge::CompileLogMaxLinesKey, MaxLogLines, GEditorPerProjectIni);
+		GConfig->GetInt(SlateAgentBridge::LiveCodingConfigSection, SlateAgentBridge::CompileLogMaxBytesKey, MaxLogBytes, GEditorPerProjectIni);
+	}
+	LogStore.SetLimits(MaxLogLines, MaxLogBytes);
+	LogStore.Reset();
+	Diagnostics.Reset();
+	History.Initialize(MaxHistoryRecords);
+
 	{
 		FScopeLock LogLock(&LogMutex);
-		LastCompileLogEntries.Reset();
 		LastCompileTimestamp = FDateTime(0);
 		LastCompileResult = ELiveCodingCompileResult::NotStarted;
 		bHasCompileResult = false;
@@ -47,48 +71,150 @@ void FSlateAgentBridgeLiveCodingManager::Initialize()
 
 void FSlateAgentBridgeLiveCodingManager::Shutdown()
 {
+	StopWatchingCompile();
+
 	if (LogCapture.IsValid())
 	{
-		if (GLog)
-		{
-			GLog->RemoveOutputDevice(LogCapture.Get());
-		}
+		LogCapture->StopCapture();
 		LogCapture.Reset();
 	}
 }
 
-bool FSlateAgentBridgeLiveCodingManager::TryBeginCompile(FString& OutErrorMessage)
+bool FSlateAgentBridgeLiveCodingManager::RequestCompile(FSlateAgentBridgeCompileTicket& OutTicket, FString& OutErrorMessage)
 {
-	bool bExpected = false;
-	if (!bCompileInProgress.CompareExchange(bExpected, true))
+	if (!EnsureCaptureAvailable(OutErrorMessage))
 	{
-		OutErrorMessage = TEXT("A Live Coding compile is already in progress.");
 		return false;
 	}
 
-	if (!EnsureCaptureAvailable(OutErrorMessage))
+	bool bStartNow = false;
 	{
-		bCompileInProgress.Store(false);
-		return false;
+		FScopeLock QueueLock(&CompileQueueMutex);
+
+		OutTicket.TicketId = NextTicketId++;
+
+		if (!bCompileInProgress.Load())
+		{
+			bCompileInProgress.Store(true);
+			bStartNow = true;
+		}
+		else if (bFollowUpQueued)
+		{
+			// A follow-up is already queued and has not started, so it will pick up this change too.
+			FCompileRun* FollowUp = FindRun(ScheduledGeneration);
+			check(FollowUp);
+			FollowUp->LastTicketId = OutTicket.TicketId;
+			OutTicket.CompileGeneration = ScheduledGeneration;
+			OutTicket.bCoalesced = true;
+			OutTicket.bStartedImmediately = false;
+		}
+		else
+		{
+			bFollowUpQueued = true;
+		}
+
+		if (!OutTicket.bCoalesced)
+		{
+			FCompileRun& Run = CompileRuns.AddDefaulted_GetRef();
+			Run.Generation = ++ScheduledGeneration;
+			Run.FirstTicketId = OutTicket.TicketId;
+			Run.LastTicketId = OutTicket.TicketId;
+			Run.State = ESlateAgentBridgeCompileTicketState::Queued;
+			Run.Result = ELiveCodingCompileResult::NotStarted;
+
+			OutTicket.CompileGeneration = Run.Generation;
+			OutTicket.bStartedImmediately = bStartNow;
+
+			if (CompileRuns.Num() > SlateAgentBridge::MaxRetainedCompileRuns)
+			{
+				CompileRuns.RemoveAt(0, CompileRuns.Num() - SlateAgentBridge::MaxRetainedCompileRuns, EAllowShrinking::No);
+			}
+		}
 	}
 
+	if (bStartNow)
 	{
-		FScopeLock LogLock(&LogMutex);
-		LastCompileTimestamp = FDateTime::UtcNow();
-		LastCompileResult = ELiveCodingCompileResult::InProgress;
-		LastErrorMessage.Reset();
+		UE_LOG(LogSlateAgentBridge, Display, TEXT("Live Coding compile request queued (ticket %llu)."), OutTicket.TicketId);
+		ScheduleCompileOnGameThread();
+	}
+	else
+	{
+		UE_LOG(LogSlateAgentBridge, Display, TEXT("Live Coding compile in progress; ticket %llu %s follow-up compile %llu."),
+			OutTicket.TicketId, OutTicket.bCoalesced ? TEXT("joined") : TEXT("queued"), OutTicket.CompileGeneration);
 	}
-
-	UE_LOG(LogSlateAgentBridge, Display, TEXT("Live Coding compile request queued."));
 
 	return true;
 }
 
+bool FSlateAgentBridgeLiveCodingManager::GetTicketStatus(uint64 TicketId, FSlateAgentBridgeCompileTicketStatus& OutStatus) const
+{
+	FScopeLock QueueLock(&CompileQueueMutex);
+
+	for (const FCompileRun& Run : CompileRuns)
+	{
+		if (TicketId >= Run.FirstTicketId && TicketId <= Run.LastTicketId)
+		{
+			OutStatus.State = Run.State;
+			OutStatus.CompileGeneration = Run.Generation;
+			OutStatus.CompileResult = CompileResultToString(Run.Result);
+			OutStatus.ErrorMessage = Run.ErrorMessage;
+			return true;
+		}
+	}
+
+	OutStatus = FSlateAgentBridgeCompileTicketStatus();
+	return false;
+}
+
+void FSlateAgentBridgeLiveCodingManager::ScheduleCompileOnGameThread()
+{
+	AsyncTask(ENamedThreads::GameThread, [this]()
+	{
+		ExecuteCompileOnGameThread();
+	});
+}
+
+FSlateAgentBridgeLiveCodingManager::FCompileRun* FSlateAgentBridgeLiveCodingManager::FindRun(uint64 Generation)
+{
+	for (int32 Index = CompileRuns.Num() - 1; Index >= 0; --Index)
+	{
+		if (CompileRuns[Index].Generation == Generation)
+		{
+			return &CompileRuns[Index];
+		}
+	}
+	return nullptr;
+}
+
 void FSlateAgentBridgeLiveCodingManager::ExecuteCompileOnGameThread()
 {
 	FString ErrorMessage;
 	ELiveCodingCompileResult CompileResult = ELiveCodingCompileResult::NotStarted;
 
+	{
+		FScopeLock QueueLock(&CompileQueueMutex);
+		// The run being started is the oldest one that has not finished yet.
+		for (FCompileRun& Run : CompileRuns)
+		{
+			if (Run.State == ESlateAgentBridgeCompileTicketState::Queued)
+			{
+				Run.State = ESlateAgentBridgeCompileTicketState::Running;
+				Run.Result = ELiveCodingCompileResult::InProgress;
+				break;
+			}
+		}
+		// Requests from here on need another compile to be covered.
+		bFollowUpQueued = false;
+	}
+
+	CompileStartUtc = FDateTime::UtcNow();
+	{
+		FScopeLock LogLock(&LogMutex);
+		LastCompileTimestamp = CompileStartUtc;
+		LastCompileResult = ELiveCodingCompileResult::InProgress;
+		LastErrorMessage.Reset();
+	}
+
 	if (!EnsureCaptureAvailable(ErrorMessage))
 	{
 		FinalizeCompileWithError(ErrorMessage, ELiveCodingCompileResult::Failure);
@@ -121,22 +247,136 @@ void FSlateAgentBridgeLiveCodingManager::ExecuteCompileOnGameThread()
 	UE_LOG(LogSlateAgentBridge, Display, TEXT("Live Coding compile started via HTTP endpoint."));
 
 	LogCapture->StartCapture();
-	const bool bCompileRequestAccepted = LiveCodingModule->Compile(ELiveCodingCompileFlags::WaitForCompletion, &CompileResult);
-	TArray<FSlateAgentBridgeLogEntry> CapturedEntries = LogCapture->StopCapture();
+	NumPublishedLogLines = 0;
+
+	{
+		FSlateAgentBridgeCompileEvent StartedEvent;
+		StartedEvent.Type = ESlateAgentBridgeCompileEventType::Started;
+		StartedEvent.CompileResult = CompileResultToString(ELiveCodingCompileResult::InProgress);
+		StartedEvent.Message = TEXT("Live Coding compile started.");
+		CompileEvent.Broadcast(StartedEvent);
+	}
+
+	// Without WaitForCompletion the call only hands the request to the Live Coding console.
+	const bool bCompileRequestAccepted = LiveCodingModule->Compile(ELiveCodingCompileFlags::None, &CompileResult);
 
 	if (!bCompileRequestAccepted)
 	{
+		LogCapture->StopCapture();
 		FinalizeCompileWithError(TEXT("Live Coding compile request was rejected."), ELiveCodingCompileResult::Failure);
 		return;
 	}
 
-	FinalizeCompile(MoveTemp(CapturedEntries), CompileResult, FString());
+	if (CompileResult != ELiveCodingCompileResult::InProgress)
+	{
+		FinalizeCompile(LogCapture->StopCapture(), CompileResult, FString());
+		return;
+	}
+
+	bPatchApplied = false;
+	CompileStartSeconds = FPlatformTime::Seconds();
+	PatchCompleteHandle = LiveCodingModule->GetOnPatchCompleteDelegate().AddRaw(this, &FSlateAgentBridgeLiveCodingManager::HandlePatchComplete);
+	CompileTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateRaw(this, &FSlateAgentBridgeLiveCodingManager::TickCompileCompletion),
+		0.1f);
+}
+
+bool FSlateAgentBridgeLiveCodingManager::TickCompileCompletion(float DeltaTime)
+{
+	ILiveCodingModule* LiveCodingModule = FModuleManager::GetModulePtr<ILiveCodingModule>(LIVE_CODING_MODULE_NAME);
+	if (LiveCodingModule && LiveCodingModule->IsCompiling())
+	{
+		if (LogCapture.IsValid())
+		{
+			PublishCapturedLogLines(LogCapture->DrainPending());
+		}
+		return true;
+	}
+
+	// The ticker handle is cleared before finalizing; returning false drops the registration.
+	CompileTickerHandle.Reset();
+	StopWatchingCompile();
+
+	TArray<FSlateAgentBridgeLogEntry> CapturedEntries = LogCapture.IsValid() ? LogCapture->StopCapture() : TArray<FSlateAgentBridgeLogEntry>();
+	const ELiveCodingCompileResult Result = LiveCodingModule ? InferCompileResult(CapturedEntries) : ELiveCodingCompileResult::Failure;
+	const FString ErrorMessage = LiveCodingModule ? FString() : FString(TEXT("Live Coding module was unloaded during the compile."));
+
+	UE_LOG(LogSlateAgentBridge, Verbose, TEXT("Live Coding compile finished after %.2f s."), FPlatformTime::Seconds() - CompileStartSeconds);
+	FinalizeCompile(MoveTemp(CapturedEntries), Result, ErrorMessage);
+	return false;
+}
+
+void FSlateAgentBridgeLiveCodingManager::PublishCapturedLogLines(TConstArrayView<FSlateAgentBridgeLogEntry> CapturedEntries)
+{
+	// Lines are published from the game thread only, so logging threads never do more than the ring push.
+	FSlateAgentBridgeCompileEvent Event;
+	Event.Type = ESlateAgentBridgeCompileEventType::LogLine;
+	for (int32 Index = NumPublishedLogLines; Index < CapturedEntries.Num(); ++Index)
+	{
+		Event.LogEntry = CapturedEntries[Index];
+		CompileEvent.Broadcast(Event);
+	}
+	NumPublishedLogLines = FMath::Max(NumPublishedLogLines, CapturedEntries.Num());
+}
+
+void FSlateAgentBridgeLiveCodingManager::HandlePatchComplete()
+{
+	bPatchApplied = true;
+}
+
+void FSlateAgentBridgeLiveCodingManager::StopWatchingCompile()
+{
+	if (CompileTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(CompileTickerHandle);
+		CompileTickerHandle.Reset();
+	}
+
+	if (PatchCompleteHandle.IsValid())
+	{
+		if (ILiveCodingModule* LiveCodingModule = FModuleManager::GetModulePtr<ILiveCodingModule>(LIVE_CODING_MODULE_NAME))
+		{
+			LiveCodingModule->GetOnPatchCompleteDelegate().Remove(PatchCompleteHandle);
+		}
+		PatchCompleteHandle.Reset();
+	}
 }
 
-void FSlateAgentBridgeLiveCodingManager::GetLastCompileSnapshot(TArray<FSlateAgentBridgeLogEntry>& OutEntries, FDateTime& OutTimestamp, ELiveCodingCompileResult& OutResult, bool& bOutHasResult, FString& OutErrorMessage, bool& bOutIsInProgress) const
+ELiveCodingCompileResult FSlateAgentBridgeLiveCodingManager::InferCompileResult(const TArray<FSlateAgentBridgeLogEntry>& CapturedEntries) const
 {
+	// The non-blocking Compile() does not report a final result; the patch-complete callback only
+	// fires for a successful patch, so failures are recognised from the captured log instead.
+	if (bPatchApplied)
+	{
+		return ELiveCodingCompileResult::Success;
+	}
+
+	for (const FSlateAgentBridgeLogEntry& Entry : CapturedEntries)
+	{
+		if (Entry.Verbosity.Equals(TEXT("Error"), ESearchCase::IgnoreCase) || Entry.Verbosity.Equals(TEXT("Fatal"), ESearchCase::IgnoreCase))
+		{
+			return ELiveCodingCompileResult::Failure;
+		}
+
+		if (Entry.Message.Contains(TEXT("cancelled"), ESearchCase::IgnoreCase) || Entry.Message.Contains(TEXT("canceled"), ESearchCase::IgnoreCase))
+		{
+			return ELiveCodingCompileResult::Cancelled;
+		}
+
+		if (Entry.Message.Contains(TEXT("failed"), ESearchCase::IgnoreCase) || Entry.Message.Contains(TEXT(": error "), ESearchCase::IgnoreCase))
+		{
+			return ELiveCodingCompileResult::Failure;
+		}
+	}
+
+	return ELiveCodingCompileResult::NoChanges;
+}
+
+void FSlateAgentBridgeLiveCodingManager::GetLastCompileSnapshot(uint64 SinceSequence, FSlateAgentBridgeCompileLogSlice& OutLog, FDateTime& OutTimestamp, ELiveCodingCompileResult& OutResult, bool& bOutHasResult, FString& OutErrorMessage, bool& bOutIsInProgress) const
+{
+	LogStore.CollectSince(SinceSequence, OutLog);
+
 	FScopeLock LogLock(&LogMutex);
-	OutEntries = LastCompileLogEntries;
 	OutTimestamp = LastCompileTimestamp;
 	OutResult = LastCompileResult;
 	bOutHasResult = bHasCompileResult;
@@ -201,16 +441,58 @@ bool FSlateAgentBridgeLiveCodingManager::EnsureLiveCodingAvailable(FString& OutE
 
 void FSlateAgentBridgeLiveCodingManager::FinalizeCompile(TArray<FSlateAgentBridgeLogEntry>&& CapturedEntries, ELiveCodingCompileResult Result, const FString& ErrorMessage)
 {
+	PublishCapturedLogLines(CapturedEntries);
+	NumPublishedLogLines = 0;
+
+	const FDateTime EndUtc = FDateTime::UtcNow();
+	History.Record(CompileStartUtc, EndUtc, CompileResultToString(Result), CapturedEntries);
+	Diagnostics.CommitCompile(CapturedEntries);
+	LogStore.CommitCompile(MoveTemp(CapturedEntries));
+
 	{
 		FScopeLock LogLock(&LogMutex);
-		LastCompileLogEntries = MoveTemp(CapturedEntries);
-		LastCompileTimestamp = FDateTime::UtcNow();
+		LastCompileTimestamp = EndUtc;
 		LastCompileResult = Result;
 		LastErrorMessage = ErrorMessage;
 		bHasCompileResult = true;
 	}
 
-	bCompileInProgress.Store(false);
+	bool bStartFollowUp = false;
+	{
+		FScopeLock QueueLock(&CompileQueueMutex);
+		for (FCompileRun& Run : CompileRuns)
+		{
+			if (Run.State == ESlateAgentBridgeCompileTicketState::Running)
+			{
+				Run.State = ESlateAgentBridgeCompileTicketState::Finished;
+				Run.Result = Result;
+				Run.ErrorMessage = ErrorMessage;
+				break;
+			}
+		}
+
+		// A follow-up queued while this compile ran keeps the in-progress flag set.
+		bStartFollowUp = bFollowUpQueued;
+		if (!bStartFollowUp)
+		{
+			bCompileInProgress.Store(false);
+		}
+		CompletedCompileCount.IncrementExchange();
+	}
+
+	FSlateAgentBridgeCompileEvent FinishedEvent;
+	FinishedEvent.Type = ESlateAgentBridgeCompileEventType::Finished;
+	FinishedEvent.CompileResult = CompileResultToString(Result);
+	FinishedEvent.Message = ErrorMessage.IsEmpty()
+		? FString::Printf(TEXT("Last compile result: %s."), *FinishedEvent.CompileResult)
+		: ErrorMessage;
+	CompileEvent.Broadcast(FinishedEvent);
+
+	if (bStartFollowUp)
+	{
+		UE_LOG(LogSlateAgentBridge, Display, TEXT("Starting coalesced follow-up Live Coding compile."));
+		ScheduleCompileOnGameThread();
+	}
 
 	switch (Result)
 	{
@@ -2,7 +2,11 @@
 
 #include "CoreMinimal.h"
 #include "SlateAgentBridgeLiveCodingTypes.h"
+#include "LiveCoding/SlateAgentBridgeCompileDiagnostics.h"
+#include "LiveCoding/SlateAgentBridgeCompileHistory.h"
+#include "LiveCoding/SlateAgentBridgeCompileLogStore.h"
 
+#include "Containers/Ticker.h"
 #include "HAL/CriticalSection.h"
 #include "Templates/Atomic.h"
 
@@ -22,30 +26,95 @@ public:
 	void Initialize();
 	void Shutdown();
 
-	/** Attempts to begin a compile; returns false if one is already running or setup failed. */
-	bool TryBeginCompile(FString& OutErrorMessage);
+	/**
+	 * Requests a compile. When idle the compile is scheduled on the game thread right away;
+	 * requests that arrive while one is in flight are coalesced into a single follow-up compile
+	 * that starts as soon as the current one is finalized. Returns false only if setup failed.
+	 */
+	bool RequestCompile(FSlateAgentBridgeCompileTicket& OutTicket, FString& OutErrorMessage);
 
-	/** Executes the Live Coding compile synchronously. Must be called on the game thread. */
-	void ExecuteCompileOnGameThread();
+	/** Resolves a ticket to the state and result of the compile run covering it. */
+	bool GetTicketStatus(uint64 TicketId, FSlateAgentBridgeCompileTicketStatus& OutStatus) const;
 
-	/** Retrieves the latest compile snapshot and status information. */
-	void GetLastCompileSnapshot(TArray<FSlateAgentBridgeLogEntry>& OutEntries, FDateTime& OutTimestamp, ELiveCodingCompileResult& OutResult, bool& bOutHasResult, FString& OutErrorMessage, bool& bOutIsInProgress) const;
+	/**
+	 * Retrieves the latest compile status and the log lines committed after SinceSequence
+	 * (0 returns the whole retained log). Log entries are shared, not copied.
+	 */
+	void GetLastCompileSnapshot(uint64 SinceSequence, FSlateAgentBridgeCompileLogSlice& OutLog, FDateTime& OutTimestamp, ELiveCodingCompileResult& OutResult, bool& bOutHasResult, FString& OutErrorMessage, bool& bOutIsInProgress) const;
 
 	static FString CompileResultToString(ELiveCodingCompileResult CompileResult);
 
+	/** Newest compile history records first; OutTotalRecords is the number currently retained. */
+	void GetCompileHistory(int32 MaxCount, TArray<FSlateAgentBridgeCompileRecord>& OutRecords, int32& OutTotalRecords) const { History.GetRecent(MaxCount, OutRecords, OutTotalRecords); }
+
+	/** Parsed compiler and linker diagnostics of the last finalized compile. */
+	const FSlateAgentBridgeCompileDiagnostics& GetDiagnostics() const { return Diagnostics; }
+
+	/** Number of compiles finalized so far; a caller that started a compile waits for this to advance. */
+	uint64 GetCompletedCompileCount() const { return CompletedCompileCount.Load(); }
+
+	/** Compile progress notifications (started, captured log lines, finished). */
+	FOnSlateAgentBridgeCompileEvent& OnCompileEvent() { return CompileEvent; }
+
 private:
+	/** One scheduled compile and the contiguous range of tickets it covers. */
+	struct FCompileRun
+	{
+		uint64 Generation = 0;
+		uint64 FirstTicketId = 0;
+		uint64 LastTicketId = 0;
+		ESlateAgentBridgeCompileTicketState State = ESlateAgentBridgeCompileTicketState::Queued;
+		ELiveCodingCompileResult Result;
+		FString ErrorMessage;
+	};
+
+	/**
+	 * Starts the Live Coding compile without waiting for it. Completion is detected from the
+	 * module's patch-complete callback and a ticker watching IsCompiling(), after which the
+	 * compile is finalized. Must be called on the game thread.
+	 */
+	void ExecuteCompileOnGameThread();
+	void ScheduleCompileOnGameThread();
+	FCompileRun* FindRun(uint64 Generation);
+
 	bool EnsureCaptureAvailable(FString& OutErrorMessage);
 	bool EnsureLiveCodingAvailable(FString& OutErrorMessage, class ILiveCodingModule*& OutModule) const;
 	void FinalizeCompile(TArray<FSlateAgentBridgeLogEntry>&& CapturedEntries, ELiveCodingCompileResult Result, const FString& ErrorMessage);
 	void FinalizeCompileWithError(const FString& ErrorMessage, ELiveCodingCompileResult Result);
+	bool TickCompileCompletion(float DeltaTime);
+	void PublishCapturedLogLines(TConstArrayView<FSlateAgentBridgeLogEntry> CapturedEntries);
+	void HandlePatchComplete();
+	void StopWatchingCompile();
+	ELiveCodingCompileResult InferCompileResult(const TArray<FSlateAgentBridgeLogEntry>& CapturedEntries) const;
 
 private:
 	TUniquePtr<FSlateAgentBridgeLiveCodingLogCapture> LogCapture;
 	mutable FCriticalSection LogMutex;
-	TArray<FSlateAgentBridgeLogEntry> LastCompileLogEntries;
+	FSlateAgentBridgeCompileLogStore LogStore;
+	FSlateAgentBridgeCompileHistory History;
+	FSlateAgentBridgeCompileDiagnostics Diagnostics;
+	FDateTime CompileStartUtc;
 	FDateTime LastCompileTimestamp;
 	ELiveCodingCompileResult LastCompileResult;
 	bool bHasCompileResult;
 	TAtomic<bool> bCompileInProgress;
+	TAtomic<uint64> CompletedCompileCount;
 	FString LastErrorMessage;
+	FOnSlateAgentBridgeCompileEvent CompileEvent;
+
+	/** Compile queue: the running run plus at most one queued follow-up, and recent finished runs. */
+	mutable FCriticalSection CompileQueueMutex;
+	TArray<FCompileRun> CompileRuns;
+	uint64 ScheduledGeneration = 0;
+	uint64 NextTicketId = 1;
+	bool bFollowUpQueued = false;
+
+	/** In-flight compile tracking; game thread only. */
+	FTSTicker::FDelegateHandle CompileTickerHandle;
+	FDelegateHandle PatchCompleteHandle;
+	bool bPatchApplied = false;
+	double CompileStartSeconds = 0.0;
+
+	/** Leading captured lines of the current compile already raised as LogLine events. */
+	int32 NumPublishedLogLines = 0;
 };
@@ -0,0 +1,73 @@
+#include "Mcp/SlateAgentBridgeMcpEventStream.h"
+
+#include "Misc/ScopeLock.h"
+
+FSlateAgentBridgeMcpEventStream::FSlateAgentBridgeMcpEventStream(int32 InMaxEvents, int64 InMaxBytes)
+	: MaxEvents(FMath::Max(1, InMaxEvents))
+	, MaxBytes(FMath::Max<int64>(1, InMaxBytes))
+{
+}
+
+uint64 FSlateAgentBridgeMcpEventStream::Publish(TArray<uint8> Data)
+{
+	FScopeLock Guard(&Mutex);
+
+	FSlateAgentBridgeMcpEvent& Event = Events.AddDefaulted_GetRef();
+	Event.Id = NextId++;
+	Event.Data = MoveTemp(Data);
+	RetainedBytes += Event.Data.GetAllocatedSize();
+
+	const uint64 PublishedId = Event.Id;
+	TrimToBudget();
+	return PublishedId;
+}
+
+void FSlateAgentBridgeMcpEventStream::CollectSince(uint64 LastEventId, TArray<FSlateAgentBridgeMcpEvent>& OutEvents, bool& bOutMissedEvents) const
+{
+	FScopeLock Guard(&Mutex);
+
+	bOutMissedEvents = false;
+	if (Events.IsEmpty())
+	{
+		bOutMissedEvents = LastEventId + 1 < NextId;
+		return;
+	}
+
+	const uint64 OldestId = Events[0].Id;
+	bOutMissedEvents = LastEventId + 1 < OldestId;
+
+	// Ids are contiguous within the buffer, so the first unseen event is found by offset.
+	const int64 FirstIndex = LastEventId < OldestId ? 0 : static_cast<int64>(LastEventId - OldestId + 1);
+	for (int64 Index = FirstIndex; Index < Events.Num(); ++Index)
+	{
+		OutEvents.Add(Events[static_cast<int32>(Index)]);
+	}
+}
+
+uint64 FSlateAgentBridgeMcpEventStream::GetLatestId() const
+{
+	FScopeLock Guard(&Mutex);
+	return NextId - 1;
+}
+
+void FSlateAgentBridgeMcpEventStream::Reset()
+{
+	FScopeLock Guard(&Mutex);
+	Events.Reset();
+	RetainedBytes = 0;
+}
+
+void FSlateAgentBridgeMcpEventStream::TrimToBudget()
+{
+	int32 DropCount = 0;
+	while (DropCount < Events.Num() - 1 && (Events.Num() - DropCount > MaxEvents || RetainedBytes > MaxBytes))
+	{
+		RetainedBytes -= Events[DropCount].Data.GetAllocatedSize();
+		++DropCount;
+	}
+
+	if (DropCount > 0)
+	{
+		Events.RemoveAt(0, DropCount, EAllowShrinking::No);
+	}
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+
+struct FSlateAgentBridgeMcpEvent
+{
+	uint64 Id = 0;
+
+	/** The notification as condensed UTF-8, ready to be framed into an SSE body. */
+	TArray<uint8> Data;
+};
+
+/**
+ * Bounded, sequence-numbered buffer of server-to-client notifications for one MCP session.
+ * Events are numbered so an SSE client can resume with Last-Event-ID; the oldest events are
+ * dropped once either the count or the byte budget is exceeded. Publishing is thread-safe.
+ */
+class FSlateAgentBridgeMcpEventStream
+{
+public:
+	explicit FSlateAgentBridgeMcpEventStream(int32 InMaxEvents = 256, int64 InMaxBytes = 512 * 1024);
+
+	/** Appends a serialized JSON-RPC notification and returns its event id. */
+	uint64 Publish(TArray<uint8> Data);
+
+	/**
+	 * Copies every retained event newer than LastEventId. bOutMissedEvents is set when events the
+	 * client has not seen were already evicted from the buffer.
+	 */
+	void CollectSince(uint64 LastEventId, TArray<FSlateAgentBridgeMcpEvent>& OutEvents, bool& bOutMissedEvents) const;
+
+	/** Id of the most recent event, or 0 if nothing was published yet. */
+	uint64 GetLatestId() const;
+
+	void Reset();
+
+private:
+	void TrimToBudget();
+
+	mutable FCriticalSection Mutex;
+	TArray<FSlateAgentBridgeMcpEvent> Events;
+	int32 MaxEvents;
+	int64 MaxBytes;
+	int64 RetainedBytes = 0;
+	uint64 NextId = 1;
+};
@@ -0,0 +1,685 @@
+#include "Mcp/SlateAgentBridgeMcpLiveCodingTools.h"
+
+#include "LiveCoding/SlateAgentBridgeLiveCodingManager.h"
+#include "SlateAgentBridgeLiveCodingTypes.h"
+#include "SlateAgentBridgeLog.h"
+
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "ILiveCodingModule.h"
+
+namespace SlateAgentBridge::Mcp
+{
+	static const TCHAR* CompileToolName = TEXT("liveCoding.compile");
+	static const TCHAR* StatusToolName = TEXT("liveCoding.status");
+	static const TCHAR* HistoryToolName = TEXT("liveCoding.history");
+	static const TCHAR* DiagnosticsToolName = TEXT("liveCoding.diagnostics");
+
+	static constexpr double DefaultCompileWaitSeconds = 300.0;
+	static constexpr double MaxCompileWaitSeconds = 1800.0;
+
+	static constexpr int32 DefaultHistoryLimit = 20;
+	static constexpr int32 DefaultDiagnosticsLimit = 200;
+}
+
+FSlateAgentBridgeMcpLiveCodingTools::FSlateAgentBridgeMcpLiveCodingTools(const TSharedRef<FSlateAgentBridgeLiveCodingManager>& InLiveCodingManager)
+	: WeakLiveCodingManager(InLiveCodingManager)
+{
+}
+
+void FSlateAgentBridgeMcpLiveCodingTools::Register(FSlateAgentBridgeMcpToolRegistry& Registry)
+{
+	TSharedRef<FJsonObject> CompileTool = MakeShared<FJsonObject>();
+	CompileTool->SetStringField(TEXT("name"), SlateAgentBridge::Mcp::CompileToolName);
+	CompileTool->SetStringField(TEXT("description"), TEXT("Trigger a UE Live Coding compile and return the latest compile snapshot."));
+	CompileTool->SetObjectField(TEXT("inputSchema"), BuildToolInputSchema(true, false));
+	CompileTool->SetObjectField(TEXT("outputSchema"), BuildLiveCodingOutputSchema());
+	TSharedPtr<FJsonObject> CompileAnnotations = MakeShared<FJsonObject>();
+	CompileAnnotations->SetBoolField(TEXT("destructiveHint"), false);
+	CompileAnnotations->SetBoolField(TEXT("readOnlyHint"), false);
+	CompileAnnotations->SetStringField(TEXT("title"), TEXT("Trigger Live Coding Compile"));
+	CompileTool->SetObjectField(TEXT("annotations"), CompileAnnotations);
+	RegisterTool(Registry, CompileTool, ESlateAgentBridgeMcpToolThread::GameThread, ESlateAgentBridgeMcpToolConcurrency::Exclusive, &FSlateAgentBridgeMcpLiveCodingTools::HandleCompile);
+
+	TSharedRef<FJsonObject> StatusTool = MakeShared<FJsonObject>();
+	StatusTool->SetStringField(TEXT("name"), SlateAgentBridge::Mcp::StatusToolName);
+	StatusTool->SetStringField(TEXT("description"), TEXT("Return the most recent Live Coding compile snapshot without starting a new compile."));
+	StatusTool->SetObjectField(TEXT("inputSchema"), BuildToolInputSchema(false, true));
+	StatusTool->SetObjectField(TEXT("outputSchema"), BuildLiveCodingOutputSchema());
+	TSharedPtr<FJsonObject> StatusAnnotations = MakeShared<FJsonObject>();
+	StatusAnnotations->SetBoolField(TEXT("destructiveHint"), false);
+	StatusAnnotations->SetBoolField(TEXT("readOnlyHint"), true);
+	StatusAnnotations->SetStringField(TEXT("title"), TEXT("Get Live Coding Status"));
+	StatusTool->SetObjectField(TEXT("annotations"), StatusAnnotations);
+	RegisterTool(Registry, StatusTool, ESlateAgentBridgeMcpToolThread::AnyThread, ESlateAgentBridgeMcpToolConcurrency::Concurrent, &FSlateAgentBridgeMcpLiveCodingTools::HandleStatus);
+
+	TSharedRef<FJsonObject> HistoryTool = MakeShared<FJsonObject>();
+	HistoryTool->SetStringField(TEXT("name"), SlateAgentBridge::Mcp::HistoryToolName);
+	HistoryTool->SetStringField(TEXT("description"), TEXT("Return recent Live Coding compiles with duration, result, error counts and per-phase timings (module detection, compile and link, patch load) where the log reveals them."));
+	HistoryTool->SetObjectField(TEXT("inputSchema"), BuildHistoryInputSchema());
+	TSharedPtr<FJsonObject> HistoryAnnotations = MakeShared<FJsonObject>();
+	HistoryAnnotations->SetBoolField(TEXT("destructiveHint"), false);
+	HistoryAnnotations->SetBoolField(TEXT("readOnlyHint"), true);
+	HistoryAnnotations->SetStringField(TEXT("title"), TEXT("Get Live Coding Compile History"));
+	HistoryTool->SetObjectField(TEXT("annotations"), HistoryAnnotations);
+	RegisterTool(Registry, HistoryTool, ESlateAgentBridgeMcpToolThread::AnyThread, ESlateAgentBridgeMcpToolConcurrency::Concurrent, &FSlateAgentBridgeMcpLiveCodingTools::HandleHistory);
+
+	TSharedRef<FJsonObject> DiagnosticsTool = MakeShared<FJsonObject>();
+	DiagnosticsTool->SetStringField(TEXT("name"), SlateAgentBridge::Mcp::DiagnosticsToolName);
+	DiagnosticsTool->SetStringField(TEXT("description"), TEXT("Return the compiler and linker diagnostics of the last Live Coding compile, parsed and deduplicated, grouped by file."));
+	DiagnosticsTool->SetObjectField(TEXT("inputSchema"), BuildDiagnosticsInputSchema());
+	TSharedPtr<FJsonObject> DiagnosticsAnnotations = MakeShared<FJsonObject>();
+	DiagnosticsAnnotations->SetBoolField(TEXT("destructiveHint"), false);
+	DiagnosticsAnnotations->SetBoolField(TEXT("readOnlyHint"), true);
+	DiagnosticsAnnotations->SetStringField(TEXT("title"), TEXT("Get Live Coding Diagnostics"));
+	DiagnosticsTool->SetObjectField(TEXT("annotations"), DiagnosticsAnnotations);
+	RegisterTool(Registry, DiagnosticsTool, ESlateAgentBridgeMcpToolThread::AnyThread, ESlateAgentBridgeMcpToolConcurrency::Concurrent, &FSlateAgentBridgeMcpLiveCodingTools::HandleDiagnostics);
+}
+
+void FSlateAgentBridgeMcpLiveCodingTools::RegisterTool(FSlateAgentBridgeMcpToolRegistry& Registry, const TSharedRef<FJsonObject>& Descriptor, ESlateAgentBridgeMcpToolThread ThreadAffinity, ESlateAgentBridgeMcpToolConcurrency Concurrency, FHandlerMethod Handler)
+{
+	FSlateAgentBridgeMcpToolDefinition Definition;
+	Definition.Descriptor = Descriptor;
+	Definition.ThreadAffinity = ThreadAffinity;
+	Definition.Concurrency = Concurrency;
+
+	// The handler holds a reference so calls still running on a worker outlive the server. The
+	// manager is not kept alive by the registry; a call that arrives after it shut down gets an error.
+	Definition.Handler = [Self = AsShared(), Handler](const FSlateAgentBridgeMcpToolCall& Call)
+	{
+		const TSharedPtr<FSlateAgentBridgeLiveCodingManager> LiveCodingManager = Self->WeakLiveCodingManager.Pin();
+		if (!LiveCodingManager.IsValid())
+		{
+			return MakeManagerUnavailableResult();
+		}
+		return ((*Self).*Handler)(*LiveCodingManager, Call);
+	};
+	Registry.RegisterTool(MoveTemp(Definition));
+}
+
+FSlateAgentBridgeMcpToolResult FSlateAgentBridgeMcpLiveCodingTools::HandleCompile(FSlateAgentBridgeLiveCodingManager& LiveCodingManager, const FSlateAgentBridgeMcpToolCall& Call) const
+{
+	bool bWaitForCompletion = false;
+	double WaitSeconds = SlateAgentBridge::Mcp::DefaultCompileWaitSeconds;
+	if (Call.Arguments.IsValid())
+	{
+		Call.Arguments->TryGetBoolField(TEXT("waitForCompletion"), bWaitForCompletion);
+		double RequestedSeconds = 0.0;
+		if (Call.Arguments->TryGetNumberField(TEXT("timeoutSeconds"), RequestedSeconds) && RequestedSeconds > 0.0)
+		{
+			WaitSeconds = FMath::Min(RequestedSeconds, SlateAgentBridge::Mcp::MaxCompileWaitSeconds);
+		}
+	}
+
+	// Batched calls cannot be held; they fall back to the immediate response.
+	bWaitForCompletion &= Call.bCanHoldResponse;
+
+	FSlateAgentBridgeMcpToolResult Result;
+
+	FSlateAgentBridgeCompileTicket Ticket;
+	FString ErrorMessage;
+	if (!LiveCodingManager.RequestCompile(Ticket, ErrorMessage))
+	{
+		TSharedRef<FJsonObject> Structured = MakeShared<FJsonObject>();
+		Structured->SetStringField(TEXT("status"), TEXT("error"));
+		Structured->SetStringField(TEXT("message"), ErrorMessage);
+		Structured->SetBoolField(TEXT("compileInProgress"), false);
+		Structured->SetBoolField(TEXT("compileStarted"), false);
+		Result.Message = ErrorMessage;
+		Result.Structured = Structured;
+		Result.bIsError = true;
+		return Result;
+	}
+
+	if (bWaitForCompletion)
+	{
+		FSlateAgentBridgeMcpCompileWait Wait;
+		Wait.IdValue = Call.IdValue;
+		Wait.TicketId = Ticket.TicketId;
+		Wait.CompileGeneration = Ticket.CompileGeneration;
+		Wait.TimeoutSeconds = WaitSeconds;
+		Result.CompileWait = MoveTemp(Wait);
+	}
+	else
+	{
+		FString StatusMessage;
+		TSharedRef<FJsonObject> Structured = BuildLiveCodingStatus(LiveCodingManager, StatusMessage);
+		StatusMessage = Ticket.bStartedImmediately
+			? FString::Printf(TEXT("Compile queued as ticket %llu. Poll liveCoding.status with this ticket for the result."), Ticket.TicketId)
+			: FString::Printf(TEXT("A compile is already running; ticket %llu will be covered by the follow-up compile. Poll liveCoding.status with this ticket for the result."), Ticket.TicketId);
+		Structured->SetStringField(TEXT("status"), TEXT("ok"));
+		Structured->SetStringField(TEXT("message"), StatusMessage);
+		Structured->SetBoolField(TEXT("compileStarted"), true);
+		Structured->SetBoolField(TEXT("coalesced"), Ticket.bCoalesced);
+		AppendTicketStatus(LiveCodingManager, Structured, Ticket.TicketId);
+
+		Result.Message = StatusMessage;
+		Result.Structured = Structured;
+	}
+
+	const FString ClientIdString = Call.ClientId.ToString();
+	UE_LOG(LogSlateAgentBridge, Verbose, TEXT("MCP client %s queued Live Coding compile (ticket %llu)%s."), *ClientIdString, Ticket.TicketId, bWaitForCompletion ? TEXT(" and is waiting for completion") : TEXT(""));
+	return Result;
+}
+
+FSlateAgentBridgeMcpToolResult FSlateAgentBridgeMcpLiveCodingTools::BuildCompileWaitResult(const FSlateAgentBridgeMcpCompileWait& Wait, bool bTimedOut) const
+{
+	const TSharedPtr<FSlateAgentBridgeLiveCodingManager> LiveCodingManager = WeakLiveCodingManager.Pin();
+	if (!LiveCodingManager.IsValid())
+	{
+		return MakeManagerUnavailableResult();
+	}
+
+	FString StatusMessage;
+	TSharedRef<FJsonObject> Structured = BuildLiveCodingStatus(*LiveCodingManager, StatusMessage);
+	if (bTimedOut)
+	{
+		StatusMessage = FString::Printf(TEXT("Compile still running after %.0f seconds. Poll liveCoding.status for the result."), Wait.TimeoutSeconds);
+		Structured->SetStringField(TEXT("message"), StatusMessage);
+	}
+	Structured->SetBoolField(TEXT("compileStarted"), true);
+	Structured->SetBoolField(TEXT("timedOut"), bTimedOut);
+
+	// The ticket's own run decides the outcome; a later follow-up may already have replaced
+	// the "last compile" fields by the time the wait is answered.
+	FSlateAgentBridgeCompileTicketStatus TicketStatus;
+	AppendTicketStatus(*LiveCodingManager, Structured, Wait.TicketId, &TicketStatus);
+
+	FSlateAgentBridgeMcpToolResult Result;
+	Result.Message = StatusMessage;
+	Result.Structured = Structured;
+	if (!bTimedOut && TicketStatus.State == ESlateAgentBridgeCompileTicketState::Finished)
+	{
+		Result.bIsError = TicketStatus.CompileResult == TEXT("Failure") || TicketStatus.CompileResult == TEXT("Cancelled");
+	}
+	return Result;
+}
+
+FSlateAgentBridgeMcpToolResult FSlateAgentBridgeMcpLiveCodingTools::HandleStatus(FSlateAgentBridgeLiveCodingManager& LiveCodingManager, const FSlateAgentBridgeMcpToolCall& Call) const
+{
+	FSlateAgentBridgeMcpToolResult Result;
+	TSharedRef<FJsonObject> Structured = BuildLiveCodingStatus(LiveCodingManager, Result.Message, ReadSinceSequence(Call.Arguments));
+	AppendRequestedTicketStatus(LiveCodingManager, Structured, Call.Arguments);
+	Result.Structured = Structured;
+
+	const FString ClientIdString = Call.ClientId.ToString();
+	UE_LOG(LogSlateAgentBridge, Verbose, TEXT("MCP client %s requested Live Coding status."), *ClientIdString);
+	return Result;
+}
+
+FSlateAgentBridgeMcpToolResult FSlateAgentBridgeMcpLiveCodingTools::HandleHistory(FSlateAgentBridgeLiveCodingManager& LiveCodingManager, const FSlateAgentBridgeMcpToolCall& Call) const
+{
+	FSlateAgentBridgeMcpToolResult Result;
+	Result.Structured = BuildCompileHistory(LiveCodingManager, Result.Message, Call.Arguments);
+	return Result;
+}
+
+FSlateAgentBridgeMcpToolResult FSlateAgentBridgeMcpLiveCodingTools::HandleDiagnostics(FSlateAgentBridgeLiveCodingManager& LiveCodingManager, const FSlateAgentBridgeMcpToolCall& Call) const
+{
+	FSlateAgentBridgeMcpToolResult Result;
+	Result.Structured = BuildCompileDiagnostics(LiveCodingManager, Result.Message, Call.Arguments);
+	return Result;
+}
+
+FSlateAgentBridgeMcpToolResult FSlateAgentBridgeMcpLiveCodingTools::MakeManagerUnavailableResult()
+{
+	FSlateAgentBridgeMcpToolResult Result;
+	Result.Message = TEXT("Live Coding is shutting down.");
+	TSharedRef<FJsonObject> Structured = MakeShared<FJsonObject>();
+	Structured->SetStringField(TEXT("status"), TEXT("error"));
+	Structured->SetStringField(TEXT("message"), Result.Message);
+	Structured->SetBoolField(TEXT("compileInProgress"), false);
+	Structured->SetBoolField(TEXT("compileStarted"), false);
+	Result.Structured = Structured;
+	Result.bIsError = true;
+	return Result;
+}
+
+uint64 FSlateAgentBridgeMcpLiveCodingTools::ReadSinceSequence(const TSharedPtr<FJsonObject>& Arguments)
+{
+	double SinceSequence = 0.0;
+	if (Arguments.IsValid() && Arguments->TryGetNumberField(TEXT("sinceSequence"), SinceSequence) && SinceSequence > 0.0)
+	{
+		return static_cast<uint64>(SinceSequence);
+	}
+	return 0;
+}
+
+void FSlateAgentBridgeMcpLiveCodingTools::AppendTicketStatus(const FSlateAgentBridgeLiveCodingManager& LiveCodingManager, const TSharedRef<FJsonObject>& Structured, uint64 TicketId, FSlateAgentBridgeCompileTicketStatus* OutStatus) const
+{
+	FSlateAgentBridgeCompileTicketStatus TicketStatus;
+	const bool bKnownTicket = LiveCodingManager.GetTicketStatus(TicketId, TicketStatus);
+
+	TSharedRef<FJsonObject> TicketObject = MakeShared<FJsonObject>();
+	TicketObject->SetNumberField(TEXT("id"), static_cast<double>(TicketId));
+	switch (TicketStatus.State)
+	{
+	case ESlateAgentBridgeCompileTicketState::Queued:
+		TicketObject->SetStringField(TEXT("state"), TEXT("queued"));
+		break;
+	case ESlateAgentBridgeCompileTicketState::Running:
+		TicketObject->SetStringField(TEXT("state"), TEXT("running"));
+		break;
+	case ESlateAgentBridgeCompileTicketState::Finished:
+		TicketObject->SetStringField(TEXT("state"), TEXT("finished"));
+		TicketObject->SetStringField(TEXT("compileResult"), TicketStatus.CompileResult);
+		if (!TicketStatus.ErrorMessage.IsEmpty())
+		{
+			TicketObject->SetStringField(TEXT("errorMessage"), TicketStatus.ErrorMessage);
+		}
+		break;
+	default:
+		TicketObject->SetStringField(TEXT("state"), TEXT("unknown"));
+		break;
+	}
+	if (bKnownTicket)
+	{
+		TicketObject->SetNumberField(TEXT("compileGeneration"), static_cast<double>(TicketStatus.CompileGeneration));
+	}
+	Structured->SetObjectField(TEXT("ticket"), TicketObject);
+
+	if (OutStatus)
+	{
+		*OutStatus = MoveTemp(TicketStatus);
+	}
+}
+
+void FSlateAgentBridgeMcpLiveCodingTools::AppendRequestedTicketStatus(const FSlateAgentBridgeLiveCodingManager& LiveCodingManager, const TSharedRef<FJsonObject>& Structured, const TSharedPtr<FJsonObject>& Arguments) const
+{
+	double TicketId = 0.0;
+	if (Arguments.IsValid() && Arguments->TryGetNumberField(TEXT("ticket"), TicketId) && TicketId > 0.0)
+	{
+		AppendTicketStatus(LiveCodingManager, Structured, static_cast<uint64>(TicketId));
+	}
+}
+
+TSharedRef<FJsonObject> FSlateAgentBridgeMcpLiveCodingTools::BuildLiveCodingStatus(const FSlateAgentBridgeLiveCodingManager& LiveCodingManager, FString& OutMessage, uint64 SinceSequence) const
+{
+	FSlateAgentBridgeCompileLogSlice LogSlice;
+	FDateTime SnapshotTimestamp;
+	ELiveCodingCompileResult SnapshotResult = ELiveCodingCompileResult::NotStarted;
+	bool bHasSnapshotResult = false;
+	FString SnapshotError;
+	bool bInProgress = false;
+
+	LiveCodingManager.GetLastCompileSnapshot(SinceSequence, LogSlice, SnapshotTimestamp, SnapshotResult, bHasSnapshotResult, SnapshotError, bInProgress);
+
+	TSharedRef<FJsonObject> Status = MakeShared<FJsonObject>();
+	const FString ResultString = FSlateAgentBridgeLiveCodingManager::CompileResultToString(SnapshotResult);
+
+	Status->SetStringField(TEXT("status"), SnapshotError.IsEmpty() ? TEXT("ok") : TEXT("error"));
+	Status->SetStringField(TEXT("compileResult"), ResultString);
+	Status->SetBoolField(TEXT("compileInProgress"), bInProgress);
+	Status->SetBoolField(TEXT("hasPreviousResult"), bHasSnapshotResult);
+	Status->SetBoolField(TEXT("compileStarted"), false);
+
+	if (SnapshotTimestamp.GetTicks() > 0)
+	{
+		Status->SetStringField(TEXT("timestampUtc"), SnapshotTimestamp.ToIso8601());
+	}
+
+	if (!SnapshotError.IsEmpty())
+	{
+		OutMessage = SnapshotError;
+	}
+	else if (bInProgress)
+	{
+		OutMessage = TEXT("Compile in progress.");
+	}
+	else if (!bHasSnapshotResult)
+	{
+		OutMessage = TEXT("No compile has been executed yet.");
+	}
+	else
+	{
+		OutMessage = FString::Printf(TEXT("Last compile result: %s."), *ResultString);
+	}
+
+	Status->SetStringField(TEXT("message"), OutMessage);
+
+	Status->SetNumberField(TEXT("logSequence"), static_cast<double>(LogSlice.LatestSequence));
+	if (LogSlice.bMissedEntries)
+	{
+		Status->SetBoolField(TEXT("logMissedEntries"), true);
+	}
+	if (LogSlice.DroppedLines > 0)
+	{
+		Status->SetNumberField(TEXT("logDroppedLines"), LogSlice.DroppedLines);
+	}
+
+	TArray<TSharedPtr<FJsonValue>> LogArray;
+	LogArray.Reserve(LogSlice.Entries.Num());
+	for (const TSharedRef<const FSlateAgentBridgeLogEntry>& EntryRef : LogSlice.Entries)
+	{
+		const FSlateAgentBridgeLogEntry& Entry = *EntryRef;
+		TSharedRef<FJsonObject> EntryObject = MakeShared<FJsonObject>();
+		EntryObject->SetNumberField(TEXT("sequence"), static_cast<double>(Entry.Sequence));
+		EntryObject->SetStringField(TEXT("timeUtc"), Entry.Timestamp.ToIso8601());
+		EntryObject->SetStringField(TEXT("category"), Entry.Category);
+		EntryObject->SetStringField(TEXT("verbosity"), Entry.Verbosity);
+		EntryObject->SetStringField(TEXT("message"), Entry.Message);
+		LogArray.Add(MakeShared<FJsonValueObject>(EntryObject));
+	}
+	Status->SetArrayField(TEXT("log"), LogArray);
+
+	return Status;
+}
+
+TSharedRef<FJsonObject> FSlateAgentBridgeMcpLiveCodingTools::BuildCompileHistory(const FSlateAgentBridgeLiveCodingManager& LiveCodingManager, FString& OutMessage, const TSharedPtr<FJsonObject>& Arguments) const
+{
+	int32 Limit = SlateAgentBridge::Mcp::DefaultHistoryLimit;
+	double RequestedLimit = 0.0;
+	if (Arguments.IsValid() && Arguments->TryGetNumberField(TEXT("limit"), RequestedLimit) && RequestedLimit > 0.0)
+	{
+		Limit = static_cast<int32>(FMath::Min(RequestedLimit, static_cast<double>(MAX_int32)));
+	}
+
+	TArray<FSlateAgentBridgeCompileRecord> Records;
+	int32 TotalRecords = 0;
+	LiveCodingManager.GetCompileHistory(Limit, Records, TotalRecords);
+
+	auto SetSecondsField = [](const TSharedRef<FJsonObject>& Target, const TCHAR* FieldName, double Seconds)
+	{
+		if (Seconds >= 0.0)
+		{
+			Target->SetNumberField(FieldName, Seconds);
+		}
+	};
+
+	double SuccessSeconds = 0.0;
+	int32 SuccessCount = 0;
+
+	TArray<TSharedPtr<FJsonValue>> RecordArray;
+	RecordArray.Reserve(Records.Num());
+	for (const FSlateAgentBridgeCompileRecord& Record : Records)
+	{
+		TSharedRef<FJsonObject> RecordObject = MakeShared<FJsonObject>();
+		RecordObject->SetStringField(TEXT("startUtc"), Record.StartUtc.ToIso8601());
+		RecordObject->SetStringField(TEXT("endUtc"), Record.EndUtc.ToIso8601());
+		RecordObject->SetNumberField(TEXT("durationSeconds"), Record.DurationSeconds);
+		RecordObject->SetStringField(TEXT("compileResult"), Record.Result);
+		RecordObject->SetNumberField(TEXT("logLines"), Record.LogLines);
+		RecordObject->SetNumberField(TEXT("errors"), Record.ErrorCount);
+		RecordObject->SetNumberField(TEXT("warnings"), Record.WarningCount);
+		SetSecondsField(RecordObject, TEXT("moduleDetectionSeconds"), Record.ModuleDetectionSeconds);
+		SetSecondsField(RecordObject, TEXT("compileLinkSeconds"), Record.CompileLinkSeconds);
+		SetSecondsField(RecordObject, TEXT("patchLoadSeconds"), Record.PatchLoadSeconds);
+		RecordArray.Add(MakeShared<FJsonValueObject>(RecordObject));
+
+		if (Record.Result == TEXT("Success"))
+		{
+			SuccessSeconds += Record.DurationSeconds;
+			++SuccessCount;
+		}
+	}
+
+	TSharedRef<FJsonObject> History = MakeShared<FJsonObject>();
+	History->SetStringField(TEXT("status"), TEXT("ok"));
+	History->SetNumberField(TEXT("totalRecords"), TotalRecords);
+	if (SuccessCount > 0)
+	{
+		History->SetNumberField(TEXT("averageSuccessSeconds"), SuccessSeconds / SuccessCount);
+	}
+	History->SetArrayField(TEXT("compiles"), RecordArray);
+
+	OutMessage = Records.IsEmpty()
+		? FString(TEXT("No compiles have been recorded yet."))
+		: FString::Printf(TEXT("Returned %d of %d recorded compiles, newest first."), Records.Num(), TotalRecords);
+	History->SetStringField(TEXT("message"), OutMessage);
+
+	return History;
+}
+
+TSharedRef<FJsonObject> FSlateAgentBridgeMcpLiveCodingTools::BuildCompileDiagnostics(const FSlateAgentBridgeLiveCodingManager& LiveCodingManager, FString& OutMessage, const TSharedPtr<FJsonObject>& Arguments) const
+{
+	FString FileFilter;
+	FString Severity;
+	int32 Limit = SlateAgentBridge::Mcp::DefaultDiagnosticsLimit;
+	if (Arguments.IsValid())
+	{
+		Arguments->TryGetStringField(TEXT("file"), FileFilter);
+		Arguments->TryGetStringField(TEXT("severity"), Severity);
+		double RequestedLimit = 0.0;
+		if (Arguments->TryGetNumberField(TEXT("limit"), RequestedLimit) && RequestedLimit > 0.0)
+		{
+			Limit = static_cast<int32>(FMath::Min(RequestedLimit, static_cast<double>(MAX_int32)));
+		}
+	}
+
+	const FSlateAgentBridgeCompileDiagnostics& Diagnostics = LiveCodingManager.GetDiagnostics();
+
+	TArray<FSlateAgentBridgeFileDiagnostics> Files;
+	int32 TotalMatches = 0;
+	Diagnostics.Query(FileFilter, Severity, Limit, Files, TotalMatches);
+
+	int32 ErrorCount = 0;
+	int32 WarningCount = 0;
+	int32 NoteCount = 0;
+	Diagnostics.GetCounts(ErrorCount, WarningCount, NoteCount);
+
+	int32 Returned = 0;
+	TArray<TSharedPtr<FJsonValue>> FileArray;
+	FileArray.Reserve(Files.Num());
+	for (const FSlateAgentBridgeFileDiagnostics& File : Files)
+	{
+		TArray<TSharedPtr<FJsonValue>> DiagnosticArray;
+		DiagnosticArray.Reserve(File.Diagnostics.Num());
+		for (const FSlateAgentBridgeDiagnostic& Diagnostic : File.Diagnostics)
+		{
+			// Zero and empty fields are omitted to keep large failing builds compact.
+			TSharedRef<FJsonObject> DiagnosticObject = MakeShared<FJsonObject>();
+			if (Diagnostic.Line > 0)
+			{
+				DiagnosticObject->SetNumberField(TEXT("line"), Diagnostic.Line);
+			}
+			if (Diagnostic.Column > 0)
+			{
+				DiagnosticObject->SetNumberField(TEXT("column"), Diagnostic.Column);
+			}
+			DiagnosticObject->SetStringField(TEXT("severity"), Diagnostic.Severity);
+			if (!Diagnostic.Code.IsEmpty())
+			{
+				DiagnosticObject->SetStringField(TEXT("code"), Diagnostic.Code);
+			}
+			DiagnosticObject->SetStringField(TEXT("message"), Diagnostic.Message);
+			DiagnosticArray.Add(MakeShared<FJsonValueObject>(DiagnosticObject));
+		}
+		Returned += File.Diagnostics.Num();
+
+		TSharedRef<FJsonObject> FileObject = MakeShared<FJsonObject>();
+		FileObject->SetStringField(TEXT("file"), File.File);
+		FileObject->SetArrayField(TEXT("diagnostics"), DiagnosticArray);
+		FileArray.Add(MakeShared<FJsonValueObject>(FileObject));
+	}
+
+	TSharedRef<FJsonObject> Result = MakeShared<FJsonObject>();
+	Result->SetStringField(TEXT("status"), TEXT("ok"));
+	Result->SetNumberField(TEXT("errors"), ErrorCount);
+	Result->SetNumberField(TEXT("warnings"), WarningCount);
+	Result->SetNumberField(TEXT("notes"), NoteCount);
+	Result->SetNumberField(TEXT("totalMatches"), TotalMatches);
+	if (Returned < TotalMatches)
+	{
+		Result->SetBoolField(TEXT("truncated"), true);
+	}
+	Result->SetArrayField(TEXT("files"), FileArray);
+
+	OutMessage = TotalMatches == 0
+		? FString(TEXT("The last compile reported no matching diagnostics."))
+		: FString::Printf(TEXT("%d error(s), %d warning(s) in the last compile; returned %d of %d matching diagnostics across %d file(s)."),
+			ErrorCount, WarningCount, Returned, TotalMatches, Files.Num());
+	Result->SetStringField(TEXT("message"), OutMessage);
+
+	return Result;
+}
+
+TSharedRef<FJsonObject> FSlateAgentBridgeMcpLiveCodingTools::BuildDiagnosticsInputSchema()
+{
+	TSharedRef<FJsonObject> Schema = MakeShared<FJsonObject>();
+	Schema->SetStringField(TEXT("type"), TEXT("object"));
+
+	TSharedPtr<FJsonObject> Properties = MakeShared<FJsonObject>();
+
+	TSharedRef<FJsonObject> FileProp = MakeShared<FJsonObject>();
+	FileProp->SetStringField(TEXT("type"), TEXT("string"));
+	FileProp->SetStringField(TEXT("description"), TEXT("Only return diagnostics for files whose path contains this string."));
+	Properties->SetObjectField(TEXT("file"), FileProp);
+
+	TSharedRef<FJsonObject> SeverityProp = MakeShared<FJsonObject>();
+	SeverityProp->SetStringField(TEXT("type"), TEXT("string"));
+	TArray<TSharedPtr<FJsonValue>> Severities;
+	Severities.Add(MakeShared<FJsonValueString>(TEXT("fatal")));
+	Severities.Add(MakeShared<FJsonValueString>(TEXT("error")));
+	Severities.Add(MakeShared<FJsonValueString>(TEXT("warning")));
+	Severities.Add(MakeShared<FJsonValueString>(TEXT("note")));
+	SeverityProp->SetArrayField(TEXT("enum"), Severities);
+	SeverityProp->SetStringField(TEXT("description"), TEXT("Only return diagnostics of this severity."));
+	Properties->SetObjectField(TEXT("severity"), SeverityProp);
+
+	TSharedRef<FJsonObject> LimitProp = MakeShared<FJsonObject>();
+	LimitProp->SetStringField(TEXT("type"), TEXT("integer"));
+	LimitProp->SetStringField(TEXT("description"), TEXT("Maximum number of diagnostics to return. Defaults to 200."));
+	Properties->SetObjectField(TEXT("limit"), LimitProp);
+
+	Schema->SetObjectField(TEXT("properties"), Properties);
+	Schema->SetBoolField(TEXT("additionalProperties"), false);
+
+	return Schema;
+}
+
+TSharedRef<FJsonObject> FSlateAgentBridgeMcpLiveCodingTools::BuildHistoryInputSchema()
+{
+	TSharedRef<FJsonObject> Schema = MakeShared<FJsonObject>();
+	Schema->SetStringField(TEXT("type"), TEXT("object"));
+
+	TSharedPtr<FJsonObject> Properties = MakeShared<FJsonObject>();
+	TSharedRef<FJsonObject> LimitProp = MakeShared<FJsonObject>();
+	LimitProp->SetStringField(TEXT("type"), TEXT("integer"));
+	LimitProp->SetStringField(TEXT("description"), TEXT("Maximum number of compiles to return, newest first. Defaults to 20."));
+	Properties->SetObjectField(TEXT("limit"), LimitProp);
+	Schema->SetObjectField(TEXT("properties"), Properties);
+	Schema->SetBoolField(TEXT("additionalProperties"), false);
+
+	return Schema;
+}
+
+TSharedRef<FJsonObject> FSlateAgentBridgeMcpLiveCodingTools::BuildToolInputSchema(bool bIncludeWaitFlag, bool bIncludeLogCursor)
+{
+	TSharedRef<FJsonObject> Schema = MakeShared<FJsonObject>();
+	Schema->SetStringField(TEXT("type"), TEXT("object"));
+
+	TSharedPtr<FJsonObject> Properties = MakeShared<FJsonObject>();
+	if (bIncludeWaitFlag)
+	{
+		TSharedRef<FJsonObject> WaitProp = MakeShared<FJsonObject>();
+		WaitProp->SetStringField(TEXT("type"), TEXT("boolean"));
+		WaitProp->SetStringField(TEXT("description"), TEXT("When true, the server holds the response until the compile finishes (or timeoutSeconds elapses) and returns the final snapshot."));
+		Properties->SetObjectField(TEXT("waitForCompletion"), WaitProp);
+
+		TSharedRef<FJsonObject> TimeoutProp = MakeShared<FJsonObject>();
+		TimeoutProp->SetStringField(TEXT("type"), TEXT("number"));
+		TimeoutProp->SetStringField(TEXT("description"), TEXT("Maximum seconds to wait when waitForCompletion is true. Defaults to 300, capped at 1800."));
+		Properties->SetObjectField(TEXT("timeoutSeconds"), TimeoutProp);
+	}
+	if (bIncludeLogCursor)
+	{
+		TSharedRef<FJsonObject> CursorProp = MakeShared<FJsonObject>();
+		CursorProp->SetStringField(TEXT("type"), TEXT("integer"));
+		CursorProp->SetStringField(TEXT("description"), TEXT("Return only log entries with a sequence greater than this value. Pass the logSequence of the previous response to poll incrementally."));
+		Properties->SetObjectField(TEXT("sinceSequence"), CursorProp);
+
+		TSharedRef<FJsonObject> TicketProp = MakeShared<FJsonObject>();
+		TicketProp->SetStringField(TEXT("type"), TEXT("integer"));
+		TicketProp->SetStringField(TEXT("description"), TEXT("Ticket returned by liveCoding.compile; adds the state and result of the compile covering it."));
+		Properties->SetObjectField(TEXT("ticket"), TicketProp);
+	}
+	Schema->SetObjectField(TEXT("properties"), Properties);
+	Schema->SetBoolField(TEXT("additionalProperties"), false);
+
+	return Schema;
+}
+
+TSharedRef<FJsonObject> FSlateAgentBridgeMcpLiveCodingTools::BuildLiveCodingOutputSchema()
+{
+	TSharedRef<FJsonObject> Schema = MakeShared<FJsonObject>();
+	Schema->SetStringField(TEXT("type"), TEXT("object"));
+
+	TSharedPtr<FJsonObject> Properties = MakeShared<FJsonObject>();
+
+	auto MakeStringProperty = [](const FString& Description)
+	{
+		TSharedRef<FJsonObject> Prop = MakeShared<FJsonObject>();
+		Prop->SetStringField(TEXT("type"), TEXT("string"));
+		if (!Description.IsEmpty())
+		{
+			Prop->SetStringField(TEXT("description"), Description);
+		}
+		return Prop;
+	};
+
+	auto MakeBooleanProperty = [](const FString& Description)
+	{
+		TSharedRef<FJsonObject> Prop = MakeShared<FJsonObject>();
+		Prop->SetStringField(TEXT("type"), TEXT("boolean"));
+		if (!Description.IsEmpty())
+		{
+			Prop->SetStringField(TEXT("description"), Description);
+		}
+		return Prop;
+	};
+
+	Properties->SetObjectField(TEXT("status"), MakeStringProperty(TEXT("High-level status of the call (ok, error, etc.).")));
+	Properties->SetObjectField(TEXT("message"), MakeStringProperty(TEXT("Human-readable summary of the snapshot.")));
+	Properties->SetObjectField(TEXT("compileResult"), MakeStringProperty(TEXT("Final Live Coding compile result.")));
+	Properties->SetObjectField(TEXT("compileInProgress"), MakeBooleanProperty(TEXT("True if a compile is currently running.")));
+	Properties->SetObjectField(TEXT("hasPreviousResult"), MakeBooleanProperty(TEXT("True if a previous compile result is available.")));
+	Properties->SetObjectField(TEXT("compileStarted"), MakeBooleanProperty(TEXT("True if the request queued a new compile.")));
+	Properties->SetObjectField(TEXT("timestampUtc"), MakeStringProperty(TEXT("UTC timestamp of the snapshot when available.")));
+	Properties->SetObjectField(TEXT("timedOut"), MakeBooleanProperty(TEXT("True if waitForCompletion gave up before the compile finished.")));
+
+	auto MakeIntegerProperty = [](const FString& Description)
+	{
+		TSharedRef<FJsonObject> Prop = MakeShared<FJsonObject>();
+		Prop->SetStringField(TEXT("type"), TEXT("integer"));
+		Prop->SetStringField(TEXT("description"), Description);
+		return Prop;
+	};
+
+	Properties->SetObjectField(TEXT("logSequence"), MakeIntegerProperty(TEXT("Sequence of the newest retained log entry; use as sinceSequence on the next poll.")));
+	Properties->SetObjectField(TEXT("logMissedEntries"), MakeBooleanProperty(TEXT("True if entries after sinceSequence are no longer retained.")));
+	Properties->SetObjectField(TEXT("coalesced"), MakeBooleanProperty(TEXT("True if the request joined a follow-up compile already queued by another caller.")));
+
+	TSharedRef<FJsonObject> TicketSchema = MakeShared<FJsonObject>();
+	TicketSchema->SetStringField(TEXT("type"), TEXT("object"));
+	TicketSchema->SetStringField(TEXT("description"), TEXT("Compile ticket: id, state (queued, running, finished, unknown), compileGeneration and, once finished, compileResult."));
+	Properties->SetObjectField(TEXT("ticket"), TicketSchema);
+	Properties->SetObjectField(TEXT("logDroppedLines"), MakeIntegerProperty(TEXT("Lines of the last compile discarded to stay within the retention caps.")));
+
+	TSharedRef<FJsonObject> LogItems = MakeShared<FJsonObject>();
+	LogItems->SetStringField(TEXT("type"), TEXT("object"));
+	TSharedPtr<FJsonObject> LogProperties = MakeShared<FJsonObject>();
+	LogProperties->SetObjectField(TEXT("sequence"), MakeIntegerProperty(TEXT("Monotonic sequence number of the log entry.")));
+	LogProperties->SetObjectField(TEXT("timeUtc"), MakeStringProperty(TEXT("Timestamp of the log entry in UTC.")));
+	LogProperties->SetObjectField(TEXT("category"), MakeStringProperty(TEXT("Log category.")));
+	LogProperties->SetObjectField(TEXT("verbosity"), MakeStringProperty(TEXT("Verbosity string.")));
+	LogProperties->SetObjectField(TEXT("message"), MakeStringProperty(TEXT("Log message text.")));
+	LogItems->SetObjectField(TEXT("properties"), LogProperties);
+	LogItems->SetBoolField(TEXT("additionalProperties"), false);
+
+	TSharedRef<FJsonObject> LogArray = MakeShared<FJsonObject>();
+	LogArray->SetStringField(TEXT("type"), TEXT("array"));
+	LogArray->SetObjectField(TEXT("items"), LogItems);
+	Properties->SetObjectField(TEXT("log"), LogArray);
+
+	Schema->SetObjectField(TEXT("properties"), Properties);
+
+	TArray<TSharedPtr<FJsonValue>> Required;
+	Required.Add(MakeShared<FJsonValueString>(TEXT("status")));
+	Required.Add(MakeShared<FJsonValueString>(TEXT("message")));
+	Required.Add(MakeShared<FJsonValueString>(TEXT("compileResult")));
+	Required.Add(MakeShared<FJsonValueString>(TEXT("compileInProgress")));
+	Schema->SetArrayField(TEXT("required"), Required);
+	Schema->SetBoolField(TEXT("additionalProperties"), true);
+
+	return Schema;
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Mcp/SlateAgentBridgeMcpToolRegistry.h"
+
+class FJsonObject;
+class FSlateAgentBridgeLiveCodingManager;
+struct FSlateAgentBridgeCompileTicketStatus;
+
+/**
+ * The liveCoding.* MCP tools. The compile tool runs on the game thread, one call at a time; the
+ * status, history and diagnostics tools only read the manager's thread-safe snapshots and run
+ * concurrently on the task graph. Registered handlers can outlive the manager, so it is only
+ * referenced weakly and pinned for the duration of each call.
+ */
+class FSlateAgentBridgeMcpLiveCodingTools : public TSharedFromThis<FSlateAgentBridgeMcpLiveCodingTools>
+{
+public:
+	explicit FSlateAgentBridgeMcpLiveCodingTools(const TSharedRef<FSlateAgentBridgeLiveCodingManager>& InLiveCodingManager);
+
+	void Register(FSlateAgentBridgeMcpToolRegistry& Registry);
+
+	/** tools/call result for a held compile call, once finished or timed out. */
+	FSlateAgentBridgeMcpToolResult BuildCompileWaitResult(const FSlateAgentBridgeMcpCompileWait& Wait, bool bTimedOut) const;
+
+private:
+	using FHandlerMethod = FSlateAgentBridgeMcpToolResult (FSlateAgentBridgeMcpLiveCodingTools::*)(FSlateAgentBridgeLiveCodingManager&, const FSlateAgentBridgeMcpToolCall&) const;
+
+	void RegisterTool(FSlateAgentBridgeMcpToolRegistry& Registry, const TSharedRef<FJsonObject>& Descriptor, ESlateAgentBridgeMcpToolThread ThreadAffinity, ESlateAgentBridgeMcpToolConcurrency Concurrency, FHandlerMethod Handler);
+
+	FSlateAgentBridgeMcpToolResult HandleCompile(FSlateAgentBridgeLiveCodingManager& LiveCodingManager, const FSlateAgentBridgeMcpToolCall& Call) const;
+	FSlateAgentBridgeMcpToolResult HandleStatus(FSlateAgentBridgeLiveCodingManager& LiveCodingManager, const FSlateAgentBridgeMcpToolCall& Call) const;
+	FSlateAgentBridgeMcpToolResult HandleHistory(FSlateAgentBridgeLiveCodingManager& LiveCodingManager, const FSlateAgentBridgeMcpToolCall& Call) const;
+	FSlateAgentBridgeMcpToolResult HandleDiagnostics(FSlateAgentBridgeLiveCodingManager& LiveCodingManager, const FSlateAgentBridgeMcpToolCall& Call) const;
+
+	TSharedRef<FJsonObject> BuildLiveCodingStatus(const FSlateAgentBridgeLiveCodingManager& LiveCodingManager, FString& OutMessage, uint64 SinceSequence = 0) const;
+	TSharedRef<FJsonObject> BuildCompileHistory(const FSlateAgentBridgeLiveCodingManager& LiveCodingManager, FString& OutMessage, const TSharedPtr<FJsonObject>& Arguments) const;
+	TSharedRef<FJsonObject> BuildCompileDiagnostics(const FSlateAgentBridgeLiveCodingManager& LiveCodingManager, FString& OutMessage, const TSharedPtr<FJsonObject>& Arguments) const;
+	void AppendTicketStatus(const FSlateAgentBridgeLiveCodingManager& LiveCodingManager, const TSharedRef<FJsonObject>& Structured, uint64 TicketId, FSlateAgentBridgeCompileTicketStatus* OutStatus = nullptr) const;
+	void AppendRequestedTicketStatus(const FSlateAgentBridgeLiveCodingManager& LiveCodingManager, const TSharedRef<FJsonObject>& Structured, const TSharedPtr<FJsonObject>& Arguments) const;
+	static FSlateAgentBridgeMcpToolResult MakeManagerUnavailableResult();
+	static uint64 ReadSinceSequence(const TSharedPtr<FJsonObject>& Arguments);
+
+	static TSharedRef<FJsonObject> BuildToolInputSchema(bool bIncludeWaitFlag, bool bIncludeLogCursor);
+	static TSharedRef<FJsonObject> BuildHistoryInputSchema();
+	static TSharedRef<FJsonObject> BuildDiagnosticsInputSchema();
+	static TSharedRef<FJsonObject> BuildLiveCodingOutputSchema();
+
+	TWeakPtr<FSlateAgentBridgeLiveCodingManager> WeakLiveCodingManager;
+};
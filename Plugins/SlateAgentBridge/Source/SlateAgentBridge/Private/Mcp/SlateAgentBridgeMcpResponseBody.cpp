@@ -0,0 +1,173 @@
+#include "Mcp/SlateAgentBridgeMcpResponseBody.h"
+
+#include "SlateAgentBridgeLog.h"
+
+#include "Containers/StringConv.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+FSlateAgentBridgeMcpResponseBody::FSlateAgentBridgeMcpResponseBody(ESlateAgentBridgeMcpBodyFraming InFraming)
+	: Framing(InFraming)
+	, Writer(Bytes)
+	, NumMessages(0)
+	, bMessageOpen(false)
+{
+}
+
+FSlateAgentBridgeUtf8JsonWriter& FSlateAgentBridgeMcpResponseBody::BeginMessage()
+{
+	check(!bMessageOpen);
+	switch (Framing)
+	{
+	case ESlateAgentBridgeMcpBodyFraming::Json:
+		check(NumMessages == 0);
+		break;
+	case ESlateAgentBridgeMcpBodyFraming::JsonArray:
+		Bytes.Add(NumMessages == 0 ? '[' : ',');
+		break;
+	case ESlateAgentBridgeMcpBodyFraming::Sse:
+		Writer.WriteRaw("data: ");
+		break;
+	}
+
+	bMessageOpen = true;
+	return Writer;
+}
+
+void FSlateAgentBridgeMcpResponseBody::EndMessage()
+{
+	check(bMessageOpen);
+	if (Framing == ESlateAgentBridgeMcpBodyFraming::Sse)
+	{
+		Writer.WriteRaw("\n\n");
+	}
+
+	bMessageOpen = false;
+	++NumMessages;
+}
+
+void FSlateAgentBridgeMcpResponseBody::AppendMessage(TConstArrayView<uint8> EncodedMessage, uint64 EventId)
+{
+	if (EventId != 0 && Framing == ESlateAgentBridgeMcpBodyFraming::Sse)
+	{
+		ANSICHAR IdLine[32];
+		const int32 Length = FCStringAnsi::Snprintf(IdLine, UE_ARRAY_COUNT(IdLine), "id: %llu\n", static_cast<unsigned long long>(EventId));
+		Writer.WriteRaw(FAnsiStringView(IdLine, FMath::Clamp(Length, 0, static_cast<int32>(UE_ARRAY_COUNT(IdLine)) - 1)));
+	}
+
+	BeginMessage().WriteRawUtf8(EncodedMessage);
+	EndMessage();
+}
+
+void FSlateAgentBridgeMcpResponseBody::AppendSseLine(FAnsiStringView Line)
+{
+	check(Framing == ESlateAgentBridgeMcpBodyFraming::Sse && !bMessageOpen);
+	Writer.WriteRaw(Line);
+	Bytes.Add('\n');
+}
+
+TArray<uint8> FSlateAgentBridgeMcpResponseBody::Finish()
+{
+	check(!bMessageOpen);
+	if (Framing == ESlateAgentBridgeMcpBodyFraming::JsonArray)
+	{
+		if (NumMessages == 0)
+		{
+			Bytes.Add('[');
+		}
+		Bytes.Add(']');
+	}
+
+	NumMessages = 0;
+	return MoveTemp(Bytes);
+}
+
+namespace
+{
+	/**
+	 * Compares the previous response path (pretty-print to an FString, split it into SSE data lines,
+	 * convert the result to UTF-8) against serializing straight into a framed UTF-8 body.
+	 * Usage: SlateAgentBridge.Mcp.BenchmarkSerialize [Iterations] [LogLines]
+	 */
+	FAutoConsoleCommand BenchmarkSerializeCommand(
+		TEXT("SlateAgentBridge.Mcp.BenchmarkSerialize"),
+		TEXT("Measures per-response serialization cost of the legacy FString path against the framed UTF-8 writer."),
+		FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+		{
+			const int32 Iterations = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 2000;
+			const int32 LogLines = Args.Num() > 1 ? FMath::Max(0, FCString::Atoi(*Args[1])) : 500;
+
+			// Shaped like a liveCoding.status reply for a failed build.
+			TArray<TSharedPtr<FJsonValue>> Lines;
+			for (int32 Index = 0; Index < LogLines; ++Index)
+			{
+				TSharedRef<FJsonObject> Line = MakeShared<FJsonObject>();
+				Line->SetNumberField(TEXT("sequence"), Index + 1);
+				Line->SetStringField(TEXT("category"), TEXT("LogLiveCoding"));
+				Line->SetStringField(TEXT("message"), FString::Printf(TEXT("Module%d.cpp(%d): error C2065: 'Value' : undeclared identifier \u2013 \"see Module%d.h\""), Index, Index * 7, Index));
+				Lines.Add(MakeShared<FJsonValueObject>(Line));
+			}
+
+			TSharedRef<FJsonObject> Structured = MakeShared<FJsonObject>();
+			Structured->SetStringField(TEXT("compileResult"), TEXT("Failure"));
+			Structured->SetArrayField(TEXT("logs"), Lines);
+
+			TSharedRef<FJsonObject> Result = MakeShared<FJsonObject>();
+			Result->SetObjectField(TEXT("structuredContent"), Structured);
+
+			TSharedRef<FJsonObject> Message = MakeShared<FJsonObject>();
+			Message->SetStringField(TEXT("jsonrpc"), TEXT("2.0"));
+			Message->SetNumberField(TEXT("id"), 42);
+			Message->SetObjectField(TEXT("result"), Result);
+
+			int64 Checksum = 0;
+
+			const double LegacyStart = FPlatformTime::Seconds();
+			for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+			{
+				FString Serialized;
+				TSharedRef<TJsonWriter<>> JsonWriter = TJsonWriterFactory<>::Create(&Serialized);
+				FJsonSerializer::Serialize(Message, JsonWriter);
+
+				TArray<FString> DataLines;
+				Serialized.ParseIntoArrayLines(DataLines);
+				FString Payload;
+				for (const FString& DataLine : DataLines)
+				{
+					Payload += TEXT("data: ");
+					Payload += DataLine;
+					Payload += TEXT("\n");
+				}
+				Payload += TEXT("\n");
+
+				const FTCHARToUTF8 Utf8Payload(*Payload);
+				TArray<uint8> Body(reinterpret_cast<const uint8*>(Utf8Payload.Get()), Utf8Payload.Length());
+				Checksum += Body.Num();
+			}
+			const double LegacySeconds = FPlatformTime::Seconds() - LegacyStart;
+
+			const double FramedStart = FPlatformTime::Seconds();
+			for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+			{
+				FSlateAgentBridgeMcpResponseBody Body(ESlateAgentBridgeMcpBodyFraming::Sse);
+				Body.BeginMessage().WriteObject(*Message);
+				Body.EndMessage();
+				Checksum += Body.Finish().Num();
+			}
+			const double FramedSeconds = FPlatformTime::Seconds() - FramedStart;
+
+			const double LegacyMicros = LegacySeconds * 1.0e6 / Iterations;
+			const double FramedMicros = FramedSeconds * 1.0e6 / Iterations;
+			UE_LOG(LogSlateAgentBridge, Display, TEXT("MCP serialize benchmark: %d iterations, %d log lines. Legacy FString path %.2f us/response, framed UTF-8 writer %.2f us/response (%.2fx). [checksum %lld]"),
+				Iterations,
+				LogLines,
+				LegacyMicros,
+				FramedMicros,
+				FramedMicros > 0.0 ? LegacyMicros / FramedMicros : 0.0,
+				Checksum);
+		}));
+}
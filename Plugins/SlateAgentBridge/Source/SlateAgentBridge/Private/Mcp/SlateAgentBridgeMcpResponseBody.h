@@ -0,0 +1,56 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Mcp/SlateAgentBridgeUtf8JsonWriter.h"
+
+/** How JSON-RPC messages are laid out in a response body. */
+enum class ESlateAgentBridgeMcpBodyFraming : uint8
+{
+	/** A single bare message, served as application/json. */
+	Json,
+
+	/** A batch reply: every message is an element of one JSON array. */
+	JsonArray,
+
+	/** One SSE event per message, served as text/event-stream. */
+	Sse
+};
+
+/**
+ * UTF-8 response body that JSON-RPC messages are serialized into directly. The framing around each
+ * message (array separators, or the SSE "data:" line and its terminator) is written in the same
+ * pass. Messages are condensed and never contain a raw line break, so an SSE event is always a
+ * single data line. The finished buffer is handed to the HTTP response without another conversion.
+ */
+class FSlateAgentBridgeMcpResponseBody
+{
+public:
+	explicit FSlateAgentBridgeMcpResponseBody(ESlateAgentBridgeMcpBodyFraming InFraming);
+
+	FSlateAgentBridgeMcpResponseBody(const FSlateAgentBridgeMcpResponseBody&) = delete;
+	FSlateAgentBridgeMcpResponseBody& operator=(const FSlateAgentBridgeMcpResponseBody&) = delete;
+
+	/** Opens the next message and returns the writer to serialize it with; close it with EndMessage. */
+	FSlateAgentBridgeUtf8JsonWriter& BeginMessage();
+	void EndMessage();
+
+	/** Adds a message encoded earlier, e.g. a retained event or a batch entry evaluated in parallel. */
+	void AppendMessage(TConstArrayView<uint8> EncodedMessage, uint64 EventId = 0);
+
+	/** Adds SSE fields or comments between events, e.g. "retry:"; Sse framing only. */
+	void AppendSseLine(FAnsiStringView Line);
+
+	int32 GetNumMessages() const { return NumMessages; }
+	ESlateAgentBridgeMcpBodyFraming GetFraming() const { return Framing; }
+	bool IsSse() const { return Framing == ESlateAgentBridgeMcpBodyFraming::Sse; }
+
+	/** Closes the framing and moves the bytes out; the body is empty afterwards. */
+	TArray<uint8> Finish();
+
+private:
+	ESlateAgentBridgeMcpBodyFraming Framing;
+	TArray<uint8> Bytes;
+	FSlateAgentBridgeUtf8JsonWriter Writer;
+	int32 NumMessages;
+	bool bMessageOpen;
+};
@@ -1,7 +1,13 @@
 #include "Mcp/SlateAgentBridgeMcpServer.h"
 
+#include "Mcp/SlateAgentBridgeMcpLiveCodingTools.h"
+#include "Mcp/SlateAgentBridgeMcpResponseBody.h"
 #include "Mcp/SlateAgentBridgeMcpSession.h"
+#include "Mcp/SlateAgentBridgeMcpToolDispatcher.h"
+#include "Mcp/SlateAgentBridgeUtf8JsonReader.h"
+#include "Mcp/SlateAgentBridgeUtf8JsonWriter.h"
 #include "LiveCoding/SlateAgentBridgeLiveCodingManager.h"
+#include "SlateAgentBridgeLiveCodingTypes.h"
 #include "SlateAgentBridgeLog.h"
 
 #include "HttpPath.h"
@@ -12,10 +18,11 @@
 #include "IHttpRouter.h"
 #include "Containers/StringConv.h"
 #include "Templates/UniquePtr.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/Compression.h"
 #include "Misc/ConfigCacheIni.h"
-#include "Misc/ScopeLock.h"
-#include "Serialization/JsonReader.h"
-#include "Serialization/JsonSerializer.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
 
 namespace SlateAgentBridge
 {
@@ -31,20 +38,103 @@ namespace SlateAgentBridge
 	static constexpr const TCHAR* HttpListenersSection = TEXT("HTTPServer.Listeners");
 	static constexpr const TCHAR* ListenerOverridesKey = TEXT("ListenerOverrides");
 	static constexpr const TCHAR* ProtocolVersionValue = TEXT("2025-06-18");
+	static constexpr int32 MaxBatchEntries = 128;
+	static constexpr const TCHAR* LastEventIdHeader = TEXT("Last-Event-ID");
+	static constexpr const TCHAR* CompileStatusNotification = TEXT("notifications/liveCoding/status");
+	static constexpr const TCHAR* LogMessageNotification = TEXT("notifications/message");
+	static constexpr const TCHAR* ToolsListChangedNotification = TEXT("notifications/tools/list_changed");
+	static constexpr const TCHAR* ToolsListRequestMethod = TEXT("tools/list");
+	static constexpr const TCHAR* ETagHeader = TEXT("ETag");
+	static constexpr const TCHAR* AcceptEncodingHeader = TEXT("accept-encoding");
+	static constexpr const TCHAR* ContentEncodingHeader = TEXT("content-encoding");
+	static constexpr const TCHAR* VaryHeader = TEXT("vary");
+
+	/** How long a GET stream is held open without events before it is answered with a keep-alive. */
+	static constexpr double EventStreamPollSeconds = 25.0;
+	static constexpr float EventStreamTickInterval = 0.1f;
+
+	/** SSE field advertising the client reconnect delay (250 ms). */
+	static constexpr const ANSICHAR* EventStreamRetryLine = "retry: 250";
+
+	static constexpr const TCHAR* McpConfigSection = TEXT("/Script/SlateAgentBridge.SlateAgentBridgeSettings");
+	static constexpr const TCHAR* McpSessionIdleTimeoutKey = TEXT("McpSessionIdleTimeoutSeconds");
+	static constexpr const TCHAR* McpMaxSessionsKey = TEXT("McpMaxSessions");
+	static constexpr const TCHAR* McpMaxEndpointsKey = TEXT("McpMaxEndpoints");
+	static constexpr const TCHAR* McpResponseCompressionKey = TEXT("McpResponseCompression");
+	static constexpr const TCHAR* McpCompressionThresholdKey = TEXT("McpCompressionThresholdBytes");
+	static constexpr int32 DefaultSessionIdleTimeoutSeconds = 1800;
+	static constexpr int32 DefaultMaxSessions = 64;
+	static constexpr int32 DefaultMaxEndpoints = 256;
+
+	/** Below this a reply fits in a few packets and compressing it costs more than it saves. */
+	static constexpr int32 DefaultCompressionThresholdBytes = 8 * 1024;
+	static constexpr double SessionSweepIntervalSeconds = 5.0;
 }
 
 namespace
 {
-	FString RequestBodyToString(const FHttpServerRequest& Request)
+	int32 ReadMcpConfigInt(const TCHAR* Key, int32 DefaultValue)
 	{
-		if (Request.Body.IsEmpty())
+		int32 Value = DefaultValue;
+		if (GConfig)
 		{
-			return FString();
+			GConfig->GetInt(SlateAgentBridge::McpConfigSection, Key, Value, GEditorPerProjectIni);
 		}
+		return Value;
+	}
+
+	bool ReadMcpConfigBool(const TCHAR* Key, bool bDefaultValue)
+	{
+		bool bValue = bDefaultValue;
+		if (GConfig)
+		{
+			GConfig->GetBool(SlateAgentBridge::McpConfigSection, Key, bValue, GEditorPerProjectIni);
+		}
+		return bValue;
+	}
+
+	/**
+	 * Quality the client's Accept-Encoding gives to Coding: its own entry wins over "*", and a coding
+	 * that is not listed at all is not acceptable.
+	 */
+	float GetAcceptedEncodingQuality(const FString& AcceptEncoding, const TCHAR* Coding)
+	{
+		float CodingQuality = -1.0f;
+		float WildcardQuality = -1.0f;
+
+		TArray<FString> Parts;
+		AcceptEncoding.ParseIntoArray(Parts, TEXT(","), true);
+		for (const FString& Part : Parts)
+		{
+			FString Token = Part;
+			FString Parameters;
+			Part.Split(TEXT(";"), &Token, &Parameters);
+			Token.TrimStartAndEndInline();
+
+			float Quality = 1.0f;
+			Parameters.TrimStartAndEndInline();
+			if (Parameters.StartsWith(TEXT("q="), ESearchCase::IgnoreCase))
+			{
+				Quality = FCString::Atof(*Parameters.Mid(2));
+			}
+
+			if (Token.Equals(Coding, ESearchCase::IgnoreCase))
+			{
+				CodingQuality = Quality;
+			}
+			else if (Token == TEXT("*"))
+			{
+				WildcardQuality = Quality;
+			}
+		}
+
+		return CodingQuality >= 0.0f ? CodingQuality : FMath::Max(WildcardQuality, 0.0f);
+	}
 
-		const ANSICHAR* Utf8Data = reinterpret_cast<const ANSICHAR*>(Request.Body.GetData());
-		FUTF8ToTCHAR Converter(Utf8Data, Request.Body.Num());
-		return FString(Converter.Length(), Converter.Get());
+	const TCHAR* GetContentEncodingToken(FName ContentEncoding)
+	{
+		// HTTP "deflate" is the zlib-wrapped stream, which is what NAME_Zlib produces.
+		return ContentEncoding == NAME_Gzip ? TEXT("gzip") : TEXT("deflate");
 	}
 
 	FString PeerEndpointString(const TSharedPtr<FInternetAddr>& PeerAddress)
@@ -108,17 +198,6 @@ bool ContainsToken(const FString& Source, const FString& Token)
 	return false;
 	}
 
-	TSharedPtr<FJsonObject> ParseJsonObject(const FString& Body)
-	{
-		TSharedPtr<FJsonObject> Object;
-		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Body);
-		if (FJsonSerializer::Deserialize(Reader, Object) && Object.IsValid())
-		{
-			return Object;
-	}
-	return nullptr;
-	}
-
 	FString MakeLogContext(const TCHAR* Phase, const FString& Endpoint, const FGuid& SessionId, const FString& Method, const FString& Accept)
 	{
 		const FString SessionString = SessionId.IsValid() ? SessionId.ToString(EGuidFormats::DigitsWithHyphens) : FString(TEXT("<none>"));
@@ -128,37 +207,66 @@ bool ContainsToken(const FString& Source, const FString& Token)
 		return FString::Printf(TEXT("%s endpoint=%s method=%s session=%s accept=%s"), Phase, *EndpointString, *MethodString, *SessionString, *AcceptString);
 	}
 
-	void AppendSseEvent(FString& Output, const FString& Message)
+	FString LogVerbosityToMcpLevel(const FString& Verbosity)
 	{
-		FString Normalized = Message;
-		Normalized.ReplaceInline(TEXT("\r\n"), TEXT("\n"));
-		Normalized.ReplaceInline(TEXT("\r"), TEXT("\n"));
-
-		TArray<FString> Lines;
-		Normalized.ParseIntoArrayLines(Lines);
-		if (Lines.IsEmpty())
+		if (Verbosity.Equals(TEXT("Fatal"), ESearchCase::IgnoreCase))
+		{
+			return TEXT("critical");
+		}
+		if (Verbosity.Equals(TEXT("Error"), ESearchCase::IgnoreCase))
 		{
-			Lines.Add(FString());
+			return TEXT("error");
 		}
+		if (Verbosity.Equals(TEXT("Warning"), ESearchCase::IgnoreCase))
+		{
+			return TEXT("warning");
+		}
+		if (Verbosity.Equals(TEXT("Display"), ESearchCase::IgnoreCase) || Verbosity.Equals(TEXT("Log"), ESearchCase::IgnoreCase))
+		{
+			return TEXT("info");
+		}
+		return TEXT("debug");
+	}
 
-		for (const FString& Line : Lines)
+	/** Finishes the body and wraps it in a response; the bytes are moved, not converted. */
+	TUniquePtr<FHttpServerResponse> MakeJsonRpcReply(FSlateAgentBridgeMcpResponseBody& Body, const FGuid& SessionId)
+	{
+		const TCHAR* ContentType = Body.IsSse() ? SlateAgentBridge::ContentTypeEventStreamResponse : SlateAgentBridge::ContentTypeJson;
+		TUniquePtr<FHttpServerResponse> Response = FHttpServerResponse::Create(Body.Finish(), ContentType);
+		Response->Headers.Add(SlateAgentBridge::CacheControlHeader, { SlateAgentBridge::NoStoreValue });
+		if (SessionId.IsValid())
 		{
-			Output += TEXT("data: ");
-			Output += Line;
-			Output += TEXT("\n");
+			Response->Headers.Add(SlateAgentBridge::SessionIdHeader, { SessionId.ToString(EGuidFormats::DigitsWithHyphens) });
 		}
+		Response->Headers.Add(SlateAgentBridge::ProtocolVersionHeader, { SlateAgentBridge::ProtocolVersionValue });
+		return Response;
+	}
 
-		Output += TEXT("\n");
+	/** Reply to a tools/call answered after the request returned, e.g. a dispatched or held call. */
+	TUniquePtr<FHttpServerResponse> MakeToolResultReply(const TSharedPtr<FJsonValue>& IdValue, const FSlateAgentBridgeMcpToolResult& Result, const FGuid& SessionId, bool bAsSse)
+	{
+		FSlateAgentBridgeMcpResponseBody Body(bAsSse ? ESlateAgentBridgeMcpBodyFraming::Sse : ESlateAgentBridgeMcpBodyFraming::Json);
+		FSlateAgentBridgeMcpSession::WriteToolResult(Body.BeginMessage(), IdValue, Result);
+		Body.EndMessage();
+		return MakeJsonRpcReply(Body, SessionId);
 	}
 }
 
-FSlateAgentBridgeMcpServer::FSlateAgentBridgeMcpServer(FSlateAgentBridgeLiveCodingManager& InLiveCodingManager, uint32 InPort, const FString& InBindAddress)
+FSlateAgentBridgeMcpServer::FSlateAgentBridgeMcpServer(const TSharedRef<FSlateAgentBridgeLiveCodingManager>& InLiveCodingManager, uint32 InPort, const FString& InBindAddress)
 	: LiveCodingManager(InLiveCodingManager)
 	, Port(InPort)
 	, BindAddress(InBindAddress)
 	, EndpointPath(SlateAgentBridge::DefaultMcpEndpointPath)
 	, bListenersStarted(false)
+	, LiveCodingTools(MakeShared<FSlateAgentBridgeMcpLiveCodingTools>(InLiveCodingManager))
+	, ToolDispatcher(MakeShared<FSlateAgentBridgeMcpToolDispatcher>())
+	, SessionTable(ReadMcpConfigInt(SlateAgentBridge::McpMaxSessionsKey, SlateAgentBridge::DefaultMaxSessions), ReadMcpConfigInt(SlateAgentBridge::McpMaxEndpointsKey, SlateAgentBridge::DefaultMaxEndpoints))
+	, SessionIdleTimeoutSeconds(FMath::Max(0, ReadMcpConfigInt(SlateAgentBridge::McpSessionIdleTimeoutKey, SlateAgentBridge::DefaultSessionIdleTimeoutSeconds)))
+	, NextSessionSweepSeconds(0.0)
+	, bResponseCompressionEnabled(ReadMcpConfigBool(SlateAgentBridge::McpResponseCompressionKey, false))
+	, CompressionThresholdBytes(FMath::Max(0, ReadMcpConfigInt(SlateAgentBridge::McpCompressionThresholdKey, SlateAgentBridge::DefaultCompressionThresholdBytes)))
 {
+	LiveCodingTools->Register(ToolRegistry);
 }
 
 FSlateAgentBridgeMcpServer::~FSlateAgentBridgeMcpServer()
@@ -210,6 +318,27 @@ bool FSlateAgentBridgeMcpServer::Start()
 		return false;
 	}
 
+	DeleteRouteHandle = Router->BindRoute(
+		EndpointPathObject,
+		EHttpServerRequestVerbs::VERB_DELETE,
+		FHttpRequestHandler::CreateRaw(this, &FSlateAgentBridgeMcpServer::HandleDeleteRequest));
+
+	if (!DeleteRouteHandle.IsValid())
+	{
+		UE_LOG(LogSlateAgentBridge, Error, TEXT("Failed to bind MCP DELETE handler at %s"), *EndpointPathObject.GetPath());
+		Router->UnbindRoute(PostRouteHandle);
+		Router->UnbindRoute(GetRouteHandle);
+		Router.Reset();
+		return false;
+	}
+
+	NextSessionSweepSeconds = FPlatformTime::Seconds() + SlateAgentBridge::SessionSweepIntervalSeconds;
+	CompileEventHandle = LiveCodingManager->OnCompileEvent().AddRaw(this, &FSlateAgentBridgeMcpServer::HandleCompileEvent);
+	ToolsChangedHandle = ToolRegistry.OnToolsChanged().AddRaw(this, &FSlateAgentBridgeMcpServer::HandleToolsChanged);
+	EventStreamTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateRaw(this, &FSlateAgentBridgeMcpServer::TickDeferredResponses),
+		SlateAgentBridge::EventStreamTickInterval);
+
 	if (!bListenersStarted)
 	{
 		HttpModule.StartAllListeners();
@@ -226,6 +355,31 @@ bool FSlateAgentBridgeMcpServer::Start()
 
 void FSlateAgentBridgeMcpServer::Stop()
 {
+	if (CompileEventHandle.IsValid())
+	{
+		LiveCodingManager->OnCompileEvent().Remove(CompileEventHandle);
+		CompileEventHandle.Reset();
+	}
+
+	if (ToolsChangedHandle.IsValid())
+	{
+		ToolRegistry.OnToolsChanged().Remove(ToolsChangedHandle);
+		ToolsChangedHandle.Reset();
+	}
+
+	if (EventStreamTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(EventStreamTickerHandle);
+		EventStreamTickerHandle.Reset();
+	}
+
+	// Answer calls still in flight first; compile calls among them turn into waits forced below.
+	// The second flush delivers replies that were handed to a worker for compression meanwhile.
+	ToolDispatcher->Flush();
+	CompleteAllEventStreams();
+	CompleteCompileWaits(/*bForceAll=*/true);
+	ToolDispatcher->Flush();
+
 	if (Router.IsValid())
 	{
 		if (PostRouteHandle.IsValid())
@@ -239,6 +393,12 @@ void FSlateAgentBridgeMcpServer::Stop()
 			Router->UnbindRoute(GetRouteHandle);
 			GetRouteHandle = FHttpRouteHandle();
 		}
+
+		if (DeleteRouteHandle.IsValid())
+		{
+			Router->UnbindRoute(DeleteRouteHandle);
+			DeleteRouteHandle = FHttpRouteHandle();
+		}
 	}
 
 	FHttpServerModule& HttpModule = FHttpServerModule::Get();
@@ -250,24 +410,20 @@ void FSlateAgentBridgeMcpServer::Stop()
 
 	Router.Reset();
 
+	TArray<TSharedPtr<FSlateAgentBridgeMcpSession>> ClosedSessions;
+	SessionTable.Reset(ClosedSessions);
+	for (const TSharedPtr<FSlateAgentBridgeMcpSession>& Session : ClosedSessions)
 	{
-		FScopeLock Guard(&SessionMutex);
-		for (auto& SessionPair : Sessions)
+		if (Session.IsValid())
 		{
-			if (SessionPair.Value.IsValid())
-			{
-				SessionPair.Value->HandleClosed();
-			}
+			Session->HandleClosed();
 		}
-		Sessions.Empty();
-		EndpointToSession.Empty();
 	}
 }
 
 bool FSlateAgentBridgeMcpServer::HandlePostRequest(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
 {
-	const FString Body = RequestBodyToString(Request);
-	if (Body.IsEmpty())
+	if (Request.Body.IsEmpty())
 	{
 		UE_LOG(LogSlateAgentBridge, Warning, TEXT("%s -> rejecting: empty body"),
 			*MakeLogContext(TEXT("POST"), PeerEndpointString(Request.PeerAddress), FGuid(), FString(), ExtractHeaderValue(Request.Headers, SlateAgentBridge::AcceptHeader)));
@@ -285,11 +441,20 @@ bool FSlateAgentBridgeMcpServer::HandlePostRequest(const FHttpServerRequest& Req
 		return true;
 	}
 
-	TSharedPtr<FJsonObject> JsonObject = ParseJsonObject(Body);
-	if (!JsonObject.IsValid())
+	// The body is parsed exactly once, straight from UTF-8; the session consumes the same DOM.
+	FString ParseError;
+	TSharedPtr<FJsonValue> JsonValue = FSlateAgentBridgeUtf8JsonReader::Parse(Request.Body, &ParseError);
+	if (JsonValue.IsValid() && JsonValue->Type != EJson::Object && JsonValue->Type != EJson::Array)
 	{
-		UE_LOG(LogSlateAgentBridge, Warning, TEXT("%s -> rejecting: invalid JSON"),
-			*MakeLogContext(TEXT("POST"), PeerEndpointString(Request.PeerAddress), FGuid(), FString(), ExtractHeaderValue(Request.Headers, SlateAgentBridge::AcceptHeader)));
+		ParseError = TEXT("Top-level JSON value must be an object or a batch array");
+		JsonValue.Reset();
+	}
+
+	if (!JsonValue.IsValid())
+	{
+		UE_LOG(LogSlateAgentBridge, Warning, TEXT("%s -> rejecting: invalid JSON (%s)"),
+			*MakeLogContext(TEXT("POST"), PeerEndpointString(Request.PeerAddress), FGuid(), FString(), ExtractHeaderValue(Request.Headers, SlateAgentBridge::AcceptHeader)),
+			*ParseError);
 		OnComplete(FHttpServerResponse::Error(EHttpServerResponseCodes::BadRequest, TEXT("invalid_json"), TEXT("Failed to parse JSON-RPC payload.")));
 		return true;
 	}
@@ -306,16 +471,51 @@ bool FSlateAgentBridgeMcpServer::HandlePostRequest(const FHttpServerRequest& Req
 	}
 
 	const FString Endpoint = PeerEndpointString(Request.PeerAddress);
+	const FName ContentEncoding = NegotiateContentEncoding(Request);
 
 	FGuid SessionId;
 	const FString SessionIdHeaderValue = ExtractHeaderValue(Request.Headers, SlateAgentBridge::SessionIdHeader);
 	const bool bHasSessionHeader = TryParseSessionId(SessionIdHeaderValue, SessionId);
 
+	// JSON-RPC 2.0 batch: an array of requests answered with one aggregated response.
+	const bool bIsBatch = JsonValue->Type == EJson::Array;
+	TSharedPtr<FJsonObject> JsonObject;
+	TArray<TSharedPtr<FJsonValue>> BatchEntries;
+
 	bool bIsInitializeRequest = false;
 	FString Method;
-	if (JsonObject->TryGetStringField(TEXT("method"), Method))
+	if (bIsBatch)
+	{
+		BatchEntries = JsonValue->AsArray();
+		if (BatchEntries.Num() > SlateAgentBridge::MaxBatchEntries)
+		{
+			UE_LOG(LogSlateAgentBridge, Warning, TEXT("%s -> rejecting: batch of %d entries exceeds %d"),
+				*MakeLogContext(TEXT("POST"), Endpoint, FGuid(), FString(), AcceptHeaderValue),
+				BatchEntries.Num(),
+				SlateAgentBridge::MaxBatchEntries);
+			OnComplete(FHttpServerResponse::Error(EHttpServerResponseCodes::RequestTooLarge, TEXT("batch_too_large"), TEXT("JSON-RPC batch contains too many entries.")));
+			return true;
+		}
+
+		for (const TSharedPtr<FJsonValue>& Entry : BatchEntries)
+		{
+			FString EntryMethod;
+			if (Entry.IsValid() && Entry->Type == EJson::Object && Entry->AsObject()->TryGetStringField(TEXT("method"), EntryMethod)
+				&& EntryMethod.Equals(TEXT("initialize"), ESearchCase::CaseSensitive))
+			{
+				bIsInitializeRequest = true;
+				break;
+			}
+		}
+		Method = FString::Printf(TEXT("<batch:%d>"), BatchEntries.Num());
+	}
+	else
 	{
-		bIsInitializeRequest = Method.Equals(TEXT("initialize"), ESearchCase::CaseSensitive);
+		JsonObject = JsonValue->AsObject();
+		if (JsonObject->TryGetStringField(TEXT("method"), Method))
+		{
+			bIsInitializeRequest = Method.Equals(TEXT("initialize"), ESearchCase::CaseSensitive);
+		}
 	}
 
 	UE_LOG(LogSlateAgentBridge, Verbose, TEXT("MCP POST %s from %s (Accept=%s, HasSessionHeader=%s)"),
@@ -389,8 +589,29 @@ bool FSlateAgentBridgeMcpServer::HandlePostRequest(const FHttpServerRequest& Req
 		}
 	}
 
-	TArray<FString> PendingMessages;
-	if (!Session->HandleMessage(Body, PendingMessages))
+	Session->MarkActive();
+
+	// The tools/list reply carries the registry's ETag so clients can tell when their copy is stale.
+	// A POST is never answered with 304: the request has a JSON-RPC id that must get a response.
+	FString ToolsListETag;
+	if (!bIsBatch && Method == SlateAgentBridge::ToolsListRequestMethod && Session->IsInitialized())
+	{
+		ToolsListETag = ToolRegistry.GetETag();
+	}
+
+	// Replies are serialized straight into the body. Clients that accept JSON get a bare message, or
+	// an array for a non-empty batch (an empty one is answered with a single error object, per
+	// JSON-RPC 2.0); SSE-only clients get one event per message.
+	const ESlateAgentBridgeMcpBodyFraming Framing = !bClientAcceptsJson
+		? ESlateAgentBridgeMcpBodyFraming::Sse
+		: (bIsBatch && !BatchEntries.IsEmpty() ? ESlateAgentBridgeMcpBodyFraming::JsonArray : ESlateAgentBridgeMcpBodyFraming::Json);
+	FSlateAgentBridgeMcpResponseBody Body(Framing);
+	TArray<FSlateAgentBridgeMcpToolInvocation> ToolInvocations;
+	TSharedPtr<FSlateAgentBridgeMcpBatchResponses> BatchResponses = bIsBatch ? MakeShared<FSlateAgentBridgeMcpBatchResponses>() : nullptr;
+	const bool bHandled = bIsBatch
+		? Session->HandleBatch(BatchEntries, *BatchResponses)
+		: Session->HandleMessage(JsonObject.ToSharedRef(), Body, ToolInvocations);
+	if (!bHandled)
 	{
 		UE_LOG(LogSlateAgentBridge, Warning, TEXT("%s -> session processing error"),
 			*MakeLogContext(TEXT("POST"), Endpoint, SessionId, Method, AcceptHeaderValue));
@@ -398,7 +619,79 @@ bool FSlateAgentBridgeMcpServer::HandlePostRequest(const FHttpServerRequest& Req
 		return true;
 	}
 
-	if (PendingMessages.IsEmpty())
+	if (ToolInvocations.Num() > 0)
+	{
+		// The call runs outside the session lock; the response is held until its handler finishes.
+		const bool bRespondAsSse = !bClientAcceptsJson;
+		const FString LogContext = MakeLogContext(TEXT("POST"), Endpoint, SessionId, Method, AcceptHeaderValue);
+		for (FSlateAgentBridgeMcpToolInvocation& Invocation : ToolInvocations)
+		{
+			TSharedPtr<FJsonValue> IdValue = Invocation.Call.IdValue;
+			ToolDispatcher->Dispatch(MoveTemp(Invocation), [this, SessionId, IdValue, bRespondAsSse, ContentEncoding, OnComplete, LogContext](FSlateAgentBridgeMcpToolResult&& Result)
+			{
+				if (!Result.CompileWait.IsSet())
+				{
+					CompleteResponse(MakeToolResultReply(IdValue, Result, SessionId, bRespondAsSse), ContentEncoding, OnComplete);
+					return;
+				}
+
+				// waitForCompletion: hold the HTTP response until FinalizeCompile or the timeout.
+				const FSlateAgentBridgeMcpCompileWait& Wait = Result.CompileWait.GetValue();
+				FPendingCompileWait& Pending = PendingCompileWaits.AddDefaulted_GetRef();
+				Pending.SessionId = SessionId;
+				Pending.IdValue = Wait.IdValue;
+				Pending.TicketId = Wait.TicketId;
+				Pending.CompileGeneration = Wait.CompileGeneration;
+				Pending.TimeoutSeconds = Wait.TimeoutSeconds;
+				Pending.DeadlineSeconds = FPlatformTime::Seconds() + Wait.TimeoutSeconds;
+				Pending.bRespondAsSse = bRespondAsSse;
+				Pending.ContentEncoding = ContentEncoding;
+				Pending.OnComplete = OnComplete;
+
+				UE_LOG(LogSlateAgentBridge, Verbose, TEXT("%s -> holding response until compile %llu completes"), *LogContext, Wait.CompileGeneration);
+			});
+		}
+		return true;
+	}
+
+	if (BatchResponses.IsValid() && BatchResponses->ToolInvocations.Num() > 0)
+	{
+		// The batch's tool calls run outside the session lock like single calls. Completions arrive on
+		// the game thread, so the last one to answer sends the whole array without further locking.
+		TArray<FSlateAgentBridgeMcpToolInvocation> BatchToolInvocations = MoveTemp(BatchResponses->ToolInvocations);
+		const TSharedRef<int32> NumOutstanding = MakeShared<int32>(BatchToolInvocations.Num());
+		const FString LogContext = MakeLogContext(TEXT("POST"), Endpoint, SessionId, Method, AcceptHeaderValue);
+		for (int32 Index = 0; Index < BatchToolInvocations.Num(); ++Index)
+		{
+			const int32 Slot = BatchResponses->ToolSlots[Index];
+			TSharedPtr<FJsonValue> IdValue = BatchToolInvocations[Index].Call.IdValue;
+			ToolDispatcher->Dispatch(MoveTemp(BatchToolInvocations[Index]), [this, BatchResponses, NumOutstanding, Slot, IdValue, SessionId, Framing, ContentEncoding, OnComplete, LogContext](FSlateAgentBridgeMcpToolResult&& Result)
+			{
+				FSlateAgentBridgeUtf8JsonWriter SlotWriter(BatchResponses->Slots[Slot]);
+				FSlateAgentBridgeMcpSession::WriteToolResult(SlotWriter, IdValue, Result);
+				if (--*NumOutstanding > 0)
+				{
+					return;
+				}
+
+				FSlateAgentBridgeMcpResponseBody BatchBody(Framing);
+				BatchResponses->AppendTo(BatchBody);
+				const int32 NumMessages = BatchBody.GetNumMessages();
+				TUniquePtr<FHttpServerResponse> Response = MakeJsonRpcReply(BatchBody, SessionId);
+				UE_LOG(LogSlateAgentBridge, Verbose, TEXT("%s -> returning batch after tool calls (%d message(s), %d bytes)"),
+					*LogContext, NumMessages, Response->Body.Num());
+				CompleteResponse(MoveTemp(Response), ContentEncoding, OnComplete);
+			});
+		}
+		return true;
+	}
+
+	if (BatchResponses.IsValid())
+	{
+		BatchResponses->AppendTo(Body);
+	}
+
+	if (Body.GetNumMessages() == 0)
 	{
 		TUniquePtr<FHttpServerResponse> AcceptedResponse = MakeUnique<FHttpServerResponse>();
 		AcceptedResponse->Code = EHttpServerResponseCodes::Accepted;
@@ -414,48 +707,85 @@ bool FSlateAgentBridgeMcpServer::HandlePostRequest(const FHttpServerRequest& Req
 		return true;
 	}
 
-	if (PendingMessages.Num() == 1 && bClientAcceptsJson)
+	const int32 NumMessages = Body.GetNumMessages();
+	TUniquePtr<FHttpServerResponse> Response = MakeJsonRpcReply(Body, SessionId);
+	if (!ToolsListETag.IsEmpty())
 	{
-		TUniquePtr<FHttpServerResponse> Response = FHttpServerResponse::Create(PendingMessages[0], SlateAgentBridge::ContentTypeJson);
-		Response->Headers.Add(SlateAgentBridge::CacheControlHeader, { SlateAgentBridge::NoStoreValue });
-		if (SessionId.IsValid())
-		{
-			Response->Headers.Add(SlateAgentBridge::SessionIdHeader, { SessionId.ToString(EGuidFormats::DigitsWithHyphens) });
-		}
-		Response->Headers.Add(SlateAgentBridge::ProtocolVersionHeader, { SlateAgentBridge::ProtocolVersionValue });
-		UE_LOG(LogSlateAgentBridge, Verbose, TEXT("%s -> returning JSON response"),
-			*MakeLogContext(TEXT("POST"), Endpoint, SessionId, Method, AcceptHeaderValue));
-		OnComplete(MoveTemp(Response));
-		return true;
+		Response->Headers.Add(SlateAgentBridge::ETagHeader, { ToolsListETag });
 	}
+	UE_LOG(LogSlateAgentBridge, Verbose, TEXT("%s -> returning %s (%d message(s), %d bytes)"),
+		*MakeLogContext(TEXT("POST"), Endpoint, SessionId, Method, AcceptHeaderValue),
+		Framing == ESlateAgentBridgeMcpBodyFraming::Sse ? TEXT("SSE") : TEXT("JSON"),
+		NumMessages,
+		Response->Body.Num());
+	CompleteResponse(MoveTemp(Response), ContentEncoding, OnComplete);
+	return true;
+}
 
-	if (!bClientAcceptsSse)
+FName FSlateAgentBridgeMcpServer::NegotiateContentEncoding(const FHttpServerRequest& Request) const
+{
+	if (!bResponseCompressionEnabled)
 	{
-		UE_LOG(LogSlateAgentBridge, Warning, TEXT("%s -> rejecting: SSE required for multi-message response"),
-			*MakeLogContext(TEXT("POST"), Endpoint, SessionId, Method, AcceptHeaderValue));
-		OnComplete(FHttpServerResponse::Error(EHttpServerResponseCodes::NoneAcceptable, TEXT("sse_required"), TEXT("Client must accept text/event-stream for multi-message responses.")));
-		return true;
+		return NAME_None;
 	}
 
-	FString SsePayload;
-	SsePayload.Reserve(PendingMessages.Num() * 64);
-	for (const FString& Message : PendingMessages)
+	const FString AcceptEncoding = ExtractHeaderValue(Request.Headers, SlateAgentBridge::AcceptEncodingHeader);
+	if (AcceptEncoding.IsEmpty())
 	{
-		AppendSseEvent(SsePayload, Message);
+		return NAME_None;
 	}
 
-	TUniquePtr<FHttpServerResponse> SseResponse = FHttpServerResponse::Create(SsePayload, SlateAgentBridge::ContentTypeEventStreamResponse);
-	SseResponse->Headers.Add(SlateAgentBridge::CacheControlHeader, { SlateAgentBridge::NoStoreValue });
-	if (SessionId.IsValid())
+	// gzip is preferred on a tie: it is what most HTTP clients decode natively.
+	const float GzipQuality = GetAcceptedEncodingQuality(AcceptEncoding, TEXT("gzip"));
+	const float DeflateQuality = GetAcceptedEncodingQuality(AcceptEncoding, TEXT("deflate"));
+	if (GzipQuality > 0.0f && GzipQuality >= DeflateQuality)
 	{
-		SseResponse->Headers.Add(SlateAgentBridge::SessionIdHeader, { SessionId.ToString(EGuidFormats::DigitsWithHyphens) });
+		return NAME_Gzip;
 	}
-	SseResponse->Headers.Add(SlateAgentBridge::ProtocolVersionHeader, { SlateAgentBridge::ProtocolVersionValue });
-	UE_LOG(LogSlateAgentBridge, Verbose, TEXT("%s -> returning SSE (%d message(s))"),
-		*MakeLogContext(TEXT("POST"), Endpoint, SessionId, Method, AcceptHeaderValue),
-		PendingMessages.Num());
-	OnComplete(MoveTemp(SseResponse));
-	return true;
+	return DeflateQuality > 0.0f ? NAME_Zlib : NAME_None;
+}
+
+void FSlateAgentBridgeMcpServer::CompleteResponse(TUniquePtr<FHttpServerResponse> Response, FName ContentEncoding, const FHttpResultCallback& OnComplete)
+{
+	if (ContentEncoding.IsNone())
+	{
+		OnComplete(MoveTemp(Response));
+		return;
+	}
+
+	// Caches must not hand a compressed reply to a client that did not ask for one.
+	Response->Headers.Add(SlateAgentBridge::VaryHeader, { SlateAgentBridge::AcceptEncodingHeader });
+	if (Response->Body.Num() < CompressionThresholdBytes)
+	{
+		OnComplete(MoveTemp(Response));
+		return;
+	}
+
+	// Deflating a multi-megabyte compile log takes milliseconds, so it stays off the thread serving HTTP.
+	TSharedRef<TUniquePtr<FHttpServerResponse>> SharedResponse = MakeShared<TUniquePtr<FHttpServerResponse>>(MoveTemp(Response));
+	ToolDispatcher->DispatchWork([SharedResponse, ContentEncoding]()
+	{
+		FHttpServerResponse& Pending = **SharedResponse;
+		const int32 UncompressedSize = Pending.Body.Num();
+
+		TArray<uint8> Compressed;
+		int32 CompressedSize = FCompression::CompressMemoryBound(ContentEncoding, UncompressedSize);
+		Compressed.SetNumUninitialized(CompressedSize);
+		if (!FCompression::CompressMemory(ContentEncoding, Compressed.GetData(), CompressedSize, Pending.Body.GetData(), UncompressedSize, COMPRESS_BiasSpeed)
+			|| CompressedSize >= UncompressedSize)
+		{
+			// Incompressible or failed: the identity body is still a valid reply.
+			return;
+		}
+
+		Compressed.SetNum(CompressedSize, EAllowShrinking::No);
+		Pending.Body = MoveTemp(Compressed);
+		Pending.Headers.Add(SlateAgentBridge::ContentEncodingHeader, { GetContentEncodingToken(ContentEncoding) });
+	},
+	[SharedResponse, OnComplete]()
+	{
+		OnComplete(MoveTemp(*SharedResponse));
+	});
 }
 
 bool FSlateAgentBridgeMcpServer::HandleGetRequest(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
@@ -496,75 +826,351 @@ bool FSlateAgentBridgeMcpServer::HandleGetRequest(const FHttpServerRequest& Requ
 		Session = CreateSession(Endpoint, SessionId);
 		bCreatedSession = true;
 	}
+	Session->MarkActive();
 
-	static const FString KeepAlivePayload(TEXT(": keep-alive\n\n"));
+	// Resume after the last event the client saw; a fresh stream starts at the current head.
+	uint64 LastEventId = Session->GetEventStream().GetLatestId();
+	const FString LastEventIdHeaderValue = ExtractHeaderValue(Request.Headers, SlateAgentBridge::LastEventIdHeader);
+	if (!bCreatedSession && !LastEventIdHeaderValue.IsEmpty())
+	{
+		uint64 ResumeId = 0;
+		if (LexTryParseString(ResumeId, *LastEventIdHeaderValue))
+		{
+			LastEventId = ResumeId;
+		}
+	}
+
+	// One open stream per session: a reconnect supersedes the previous request.
+	for (int32 Index = PendingEventStreams.Num() - 1; Index >= 0; --Index)
+	{
+		if (PendingEventStreams[Index].SessionId == SessionId)
+		{
+			TryCompleteEventStream(PendingEventStreams[Index], /*bForce=*/true);
+			PendingEventStreams.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+		}
+	}
 
-	TUniquePtr<FHttpServerResponse> Response = FHttpServerResponse::Create(KeepAlivePayload, SlateAgentBridge::ContentTypeEventStreamResponse);
+	FPendingEventStream Pending;
+	Pending.SessionId = SessionId;
+	Pending.LastEventId = LastEventId;
+	Pending.DeadlineSeconds = FPlatformTime::Seconds() + SlateAgentBridge::EventStreamPollSeconds;
+	Pending.OnComplete = OnComplete;
+
+	UE_LOG(LogSlateAgentBridge, Verbose, TEXT("%s -> GET SSE %s (after event %llu)"),
+		*MakeLogContext(TEXT("GET"), Endpoint, SessionId, FString(), AcceptHeaderValue),
+		bCreatedSession ? TEXT("created new session") : TEXT("stream"),
+		LastEventId);
+
+	// A brand-new session is answered immediately so the client learns its Mcp-Session-Id.
+	if (!TryCompleteEventStream(Pending, /*bForce=*/bCreatedSession))
+	{
+		PendingEventStreams.Add(MoveTemp(Pending));
+	}
+	return true;
+}
+
+bool FSlateAgentBridgeMcpServer::HandleDeleteRequest(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+{
+	const FString Endpoint = PeerEndpointString(Request.PeerAddress);
+
+	FGuid SessionId;
+	if (!TryParseSessionId(ExtractHeaderValue(Request.Headers, SlateAgentBridge::SessionIdHeader), SessionId))
+	{
+		UE_LOG(LogSlateAgentBridge, Warning, TEXT("%s -> rejecting: session missing"),
+			*MakeLogContext(TEXT("DELETE"), Endpoint, FGuid(), FString(), FString()));
+		OnComplete(FHttpServerResponse::Error(EHttpServerResponseCodes::BadRequest, TEXT("missing_session"), TEXT("Mcp-Session-Id header is required.")));
+		return true;
+	}
+
+	TSharedPtr<FSlateAgentBridgeMcpSession> Session = SessionTable.Remove(SessionId);
+	if (!Session.IsValid())
+	{
+		OnComplete(FHttpServerResponse::Error(EHttpServerResponseCodes::NotFound, TEXT("unknown_session"), TEXT("MCP session not found.")));
+		return true;
+	}
+
+	CloseSession(SessionId, Session, TEXT("terminated by client"));
+
+	TUniquePtr<FHttpServerResponse> Response = MakeUnique<FHttpServerResponse>();
+	Response->Code = EHttpServerResponseCodes::NoContent;
 	Response->Headers.Add(SlateAgentBridge::CacheControlHeader, { SlateAgentBridge::NoStoreValue });
-	Response->Headers.Add(SlateAgentBridge::SessionIdHeader, { SessionId.ToString(EGuidFormats::DigitsWithHyphens) });
 	Response->Headers.Add(SlateAgentBridge::ProtocolVersionHeader, { SlateAgentBridge::ProtocolVersionValue });
-	UE_LOG(LogSlateAgentBridge, Verbose, TEXT("%s -> GET SSE %s"),
-		*MakeLogContext(TEXT("GET"), Endpoint, SessionId, FString(), AcceptHeaderValue),
-		bCreatedSession ? TEXT("created new session") : TEXT("keep-alive"));
 	OnComplete(MoveTemp(Response));
 	return true;
 }
 
-TSharedPtr<FSlateAgentBridgeMcpSession> FSlateAgentBridgeMcpServer::FindSessionById(const FGuid& ClientId)
+void FSlateAgentBridgeMcpServer::HandleCompileEvent(const FSlateAgentBridgeCompileEvent& Event)
 {
-	FScopeLock Guard(&SessionMutex);
-	if (const TSharedPtr<FSlateAgentBridgeMcpSession>* SessionPtr = Sessions.Find(ClientId))
+	// The manager raises every compile event on the game thread, log lines included.
+	check(IsInGameThread());
+
+	TArray<uint8> Notification;
+	if (Event.Type == ESlateAgentBridgeCompileEventType::LogLine)
 	{
-		return *SessionPtr;
+		TSharedRef<FJsonObject> Data = MakeShared<FJsonObject>();
+		Data->SetStringField(TEXT("timeUtc"), Event.LogEntry.Timestamp.ToIso8601());
+		Data->SetStringField(TEXT("message"), Event.LogEntry.Message);
+
+		TSharedRef<FJsonObject> Params = MakeShared<FJsonObject>();
+		Params->SetStringField(TEXT("level"), LogVerbosityToMcpLevel(Event.LogEntry.Verbosity));
+		Params->SetStringField(TEXT("logger"), Event.LogEntry.Category);
+		Params->SetObjectField(TEXT("data"), Data);
+		Notification = FSlateAgentBridgeMcpSession::SerializeNotification(SlateAgentBridge::LogMessageNotification, Params);
+	}
+	else
+	{
+		TSharedRef<FJsonObject> Params = MakeShared<FJsonObject>();
+		Params->SetStringField(TEXT("phase"), Event.Type == ESlateAgentBridgeCompileEventType::Started ? TEXT("started") : TEXT("finished"));
+		Params->SetStringField(TEXT("compileResult"), Event.CompileResult);
+		Params->SetStringField(TEXT("message"), Event.Message);
+		Params->SetBoolField(TEXT("compileInProgress"), Event.Type == ESlateAgentBridgeCompileEventType::Started);
+		Notification = FSlateAgentBridgeMcpSession::SerializeNotification(SlateAgentBridge::CompileStatusNotification, Params);
+	}
+
+	TArray<TSharedPtr<FSlateAgentBridgeMcpSession>> Targets;
+	SessionTable.GetAll(Targets);
+
+	// FinalizeCompile runs on the game thread, so held compile calls are answered right away.
+	if (Event.Type == ESlateAgentBridgeCompileEventType::Finished)
+	{
+		CompleteCompileWaits(/*bForceAll=*/false);
+	}
+
+	for (const TSharedPtr<FSlateAgentBridgeMcpSession>& Target : Targets)
+	{
+		if (Target.IsValid())
+		{
+			Target->GetEventStream().Publish(Notification);
+		}
 	}
-	return nullptr;
 }
 
-TSharedPtr<FSlateAgentBridgeMcpSession> FSlateAgentBridgeMcpServer::CreateSession(const FString& Endpoint, FGuid& OutSessionId)
+void FSlateAgentBridgeMcpServer::HandleToolsChanged()
 {
-	FScopeLock Guard(&SessionMutex);
-	OutSessionId = FGuid::NewGuid();
+	const TArray<uint8> Notification = FSlateAgentBridgeMcpSession::SerializeNotification(SlateAgentBridge::ToolsListChangedNotification, MakeShared<FJsonObject>());
+
+	TArray<TSharedPtr<FSlateAgentBridgeMcpSession>> Targets;
+	SessionTable.GetAll(Targets);
+	for (const TSharedPtr<FSlateAgentBridgeMcpSession>& Target : Targets)
+	{
+		if (Target.IsValid() && Target->IsInitialized())
+		{
+			Target->GetEventStream().Publish(Notification);
+		}
+	}
+}
 
-	TSharedPtr<FSlateAgentBridgeMcpSession> Session = MakeShared<FSlateAgentBridgeMcpSession>(LiveCodingManager, OutSessionId, Endpoint);
-	Sessions.Add(OutSessionId, Session);
-	EndpointToSession.Add(Endpoint, OutSessionId);
+bool FSlateAgentBridgeMcpServer::TickDeferredResponses(float DeltaTime)
+{
+	CompleteCompileWaits(/*bForceAll=*/false);
 
-	UE_LOG(LogSlateAgentBridge, Display, TEXT("MCP session created for client %s (%s)."), *OutSessionId.ToString(EGuidFormats::DigitsWithHyphens), *Endpoint);
-	return Session;
+	const double NowSeconds = FPlatformTime::Seconds();
+	for (int32 Index = PendingEventStreams.Num() - 1; Index >= 0; --Index)
+	{
+		FPendingEventStream& Pending = PendingEventStreams[Index];
+		if (TryCompleteEventStream(Pending, NowSeconds >= Pending.DeadlineSeconds))
+		{
+			PendingEventStreams.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+		}
+	}
+
+	if (NowSeconds >= NextSessionSweepSeconds)
+	{
+		NextSessionSweepSeconds = NowSeconds + SlateAgentBridge::SessionSweepIntervalSeconds;
+		EvictIdleSessions();
+	}
+	return true;
 }
 
-TSharedPtr<FSlateAgentBridgeMcpSession> FSlateAgentBridgeMcpServer::FindSessionForEndpoint(const FString& Endpoint, FGuid& OutSessionId)
+bool FSlateAgentBridgeMcpServer::TryCompleteEventStream(FPendingEventStream& Pending, bool bForce)
 {
-	FScopeLock Guard(&SessionMutex);
-	if (const FGuid* SessionIdPtr = EndpointToSession.Find(Endpoint))
+	TSharedPtr<FSlateAgentBridgeMcpSession> Session = FindSessionById(Pending.SessionId);
+
+	TArray<FSlateAgentBridgeMcpEvent> Events;
+	bool bMissedEvents = false;
+	if (Session.IsValid())
+	{
+		Session->GetEventStream().CollectSince(Pending.LastEventId, Events, bMissedEvents);
+	}
+
+	if (Events.IsEmpty() && !bMissedEvents && !bForce && Session.IsValid())
+	{
+		return false;
+	}
+
+	FSlateAgentBridgeMcpResponseBody Body(ESlateAgentBridgeMcpBodyFraming::Sse);
+	Body.AppendSseLine(SlateAgentBridge::EventStreamRetryLine);
+	if (bMissedEvents)
+	{
+		Body.AppendSseLine(": events after the requested Last-Event-ID were dropped from the buffer");
+	}
+	for (const FSlateAgentBridgeMcpEvent& Event : Events)
+	{
+		Body.AppendMessage(Event.Data, Event.Id);
+	}
+	if (Events.IsEmpty())
 	{
-		if (TSharedPtr<FSlateAgentBridgeMcpSession>* SessionPtr = Sessions.Find(*SessionIdPtr))
+		Body.AppendSseLine(": keep-alive\n");
+	}
+
+	TUniquePtr<FHttpServerResponse> Response = FHttpServerResponse::Create(Body.Finish(), SlateAgentBridge::ContentTypeEventStreamResponse);
+	Response->Headers.Add(SlateAgentBridge::CacheControlHeader, { SlateAgentBridge::NoStoreValue });
+	Response->Headers.Add(SlateAgentBridge::SessionIdHeader, { Pending.SessionId.ToString(EGuidFormats::DigitsWithHyphens) });
+	Response->Headers.Add(SlateAgentBridge::ProtocolVersionHeader, { SlateAgentBridge::ProtocolVersionValue });
+	Pending.OnComplete(MoveTemp(Response));
+	return true;
+}
+
+void FSlateAgentBridgeMcpServer::CompleteCompileWaits(bool bForceAll)
+{
+	if (PendingCompileWaits.IsEmpty())
+	{
+		return;
+	}
+
+	const uint64 CompletedCount = LiveCodingManager->GetCompletedCompileCount();
+	const double NowSeconds = FPlatformTime::Seconds();
+
+	for (int32 Index = PendingCompileWaits.Num() - 1; Index >= 0; --Index)
+	{
+		FPendingCompileWait& Pending = PendingCompileWaits[Index];
+		const bool bFinished = CompletedCount >= Pending.CompileGeneration;
+		const bool bTimedOut = !bFinished && (bForceAll || NowSeconds >= Pending.DeadlineSeconds);
+		if (!bFinished && !bTimedOut)
 		{
-			OutSessionId = *SessionIdPtr;
-			return *SessionPtr;
+			continue;
 		}
+
+		FSlateAgentBridgeMcpCompileWait Wait;
+		Wait.IdValue = Pending.IdValue;
+		Wait.TicketId = Pending.TicketId;
+		Wait.CompileGeneration = Pending.CompileGeneration;
+		Wait.TimeoutSeconds = Pending.TimeoutSeconds;
+
+		CompleteResponse(MakeToolResultReply(Pending.IdValue, LiveCodingTools->BuildCompileWaitResult(Wait, bTimedOut), Pending.SessionId, Pending.bRespondAsSse), Pending.ContentEncoding, Pending.OnComplete);
+		PendingCompileWaits.RemoveAtSwap(Index, 1, EAllowShrinking::No);
 	}
-	return nullptr;
 }
 
-TSharedPtr<FSlateAgentBridgeMcpSession> FSlateAgentBridgeMcpServer::FindDefaultSession(FGuid& OutSessionId)
+void FSlateAgentBridgeMcpServer::CompleteAllEventStreams()
 {
-	FScopeLock Guard(&SessionMutex);
-	if (Sessions.Num() == 1)
+	TArray<FPendingEventStream> Streams = MoveTemp(PendingEventStreams);
+	PendingEventStreams.Reset();
+	for (FPendingEventStream& Pending : Streams)
+	{
+		TryCompleteEventStream(Pending, /*bForce=*/true);
+	}
+}
+
+void FSlateAgentBridgeMcpServer::EvictIdleSessions()
+{
+	if (SessionIdleTimeoutSeconds <= 0.0)
+	{
+		return;
+	}
+
+	TArray<FGuid> IdleSessionIds;
+	SessionTable.CollectIdle(SessionIdleTimeoutSeconds, IdleSessionIds);
+
+	for (const FGuid& SessionId : IdleSessionIds)
+	{
+		// A held GET or compile wait means the client is still listening, even without new requests.
+		if (HasHeldResponses(SessionId))
+		{
+			if (TSharedPtr<FSlateAgentBridgeMcpSession> Session = SessionTable.Find(SessionId))
+			{
+				Session->MarkActive();
+			}
+			continue;
+		}
+
+		if (TSharedPtr<FSlateAgentBridgeMcpSession> Session = SessionTable.Remove(SessionId))
+		{
+			CloseSession(SessionId, Session, TEXT("idle timeout"));
+		}
+	}
+}
+
+void FSlateAgentBridgeMcpServer::CloseSession(const FGuid& SessionId, const TSharedPtr<FSlateAgentBridgeMcpSession>& Session, const TCHAR* Reason)
+{
+	// The session is already out of the table; answer anything still held for it before closing.
+	for (int32 Index = PendingEventStreams.Num() - 1; Index >= 0; --Index)
+	{
+		if (PendingEventStreams[Index].SessionId == SessionId)
+		{
+			TryCompleteEventStream(PendingEventStreams[Index], /*bForce=*/true);
+			PendingEventStreams.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+		}
+	}
+
+	for (int32 Index = PendingCompileWaits.Num() - 1; Index >= 0; --Index)
 	{
-		for (const TPair<FGuid, TSharedPtr<FSlateAgentBridgeMcpSession>>& Pair : Sessions)
+		FPendingCompileWait& Pending = PendingCompileWaits[Index];
+		if (Pending.SessionId != SessionId)
 		{
-			OutSessionId = Pair.Key;
-			return Pair.Value;
+			continue;
 		}
+
+		FSlateAgentBridgeMcpCompileWait Wait;
+		Wait.IdValue = Pending.IdValue;
+		Wait.TicketId = Pending.TicketId;
+		Wait.CompileGeneration = Pending.CompileGeneration;
+		Wait.TimeoutSeconds = Pending.TimeoutSeconds;
+
+		const bool bFinished = LiveCodingManager->GetCompletedCompileCount() >= Pending.CompileGeneration;
+		CompleteResponse(MakeToolResultReply(Pending.IdValue, LiveCodingTools->BuildCompileWaitResult(Wait, !bFinished), Pending.SessionId, Pending.bRespondAsSse), Pending.ContentEncoding, Pending.OnComplete);
+		PendingCompileWaits.RemoveAtSwap(Index, 1, EAllowShrinking::No);
 	}
-	return nullptr;
+
+	if (Session.IsValid())
+	{
+		Session->HandleClosed();
+	}
+
+	UE_LOG(LogSlateAgentBridge, Display, TEXT("MCP session %s closed (%s)."), *SessionId.ToString(EGuidFormats::DigitsWithHyphens), Reason);
+}
+
+bool FSlateAgentBridgeMcpServer::HasHeldResponses(const FGuid& SessionId) const
+{
+	return PendingEventStreams.ContainsByPredicate([&SessionId](const FPendingEventStream& Pending) { return Pending.SessionId == SessionId; })
+		|| PendingCompileWaits.ContainsByPredicate([&SessionId](const FPendingCompileWait& Pending) { return Pending.SessionId == SessionId; });
+}
+
+TSharedPtr<FSlateAgentBridgeMcpSession> FSlateAgentBridgeMcpServer::FindSessionById(const FGuid& ClientId)
+{
+	return SessionTable.Find(ClientId);
+}
+
+TSharedPtr<FSlateAgentBridgeMcpSession> FSlateAgentBridgeMcpServer::CreateSession(const FString& Endpoint, FGuid& OutSessionId)
+{
+	OutSessionId = FGuid::NewGuid();
+
+	TSharedRef<FSlateAgentBridgeMcpSession> Session = MakeShared<FSlateAgentBridgeMcpSession>(ToolRegistry, OutSessionId, Endpoint);
+	TSharedPtr<FSlateAgentBridgeMcpSession> Evicted = SessionTable.Add(OutSessionId, Session);
+	SessionTable.AssociateEndpoint(Endpoint, OutSessionId);
+
+	UE_LOG(LogSlateAgentBridge, Display, TEXT("MCP session created for client %s (%s)."), *OutSessionId.ToString(EGuidFormats::DigitsWithHyphens), *Endpoint);
+
+	if (Evicted.IsValid())
+	{
+		CloseSession(Evicted->GetClientId(), Evicted, TEXT("session limit reached"));
+	}
+	return Session;
+}
+
+TSharedPtr<FSlateAgentBridgeMcpSession> FSlateAgentBridgeMcpServer::FindSessionForEndpoint(const FString& Endpoint, FGuid& OutSessionId)
+{
+	return SessionTable.FindForEndpoint(Endpoint, OutSessionId);
+}
+
+TSharedPtr<FSlateAgentBridgeMcpSession> FSlateAgentBridgeMcpServer::FindDefaultSession(FGuid& OutSessionId)
+{
+	return SessionTable.FindSingle(OutSessionId);
 }
 
 void FSlateAgentBridgeMcpServer::AssociateEndpointWithSession(const FString& Endpoint, const FGuid& SessionId)
 {
-	FScopeLock Guard(&SessionMutex);
-	EndpointToSession.Add(Endpoint, SessionId);
+	SessionTable.AssociateEndpoint(Endpoint, SessionId);
 }
 
 bool FSlateAgentBridgeMcpServer::ValidateProtocolVersion(const FString& ProtocolVersionHeader) const
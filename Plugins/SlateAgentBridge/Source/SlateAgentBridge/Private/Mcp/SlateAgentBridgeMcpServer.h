@@ -1,20 +1,29 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "HAL/CriticalSection.h"
+#include "Containers/Ticker.h"
 #include "HttpResultCallback.h"
 #include "HttpRouteHandle.h"
 #include "HttpServerRequest.h"
 #include "Misc/Guid.h"
+#include "UObject/NameTypes.h"
+#include "Mcp/SlateAgentBridgeMcpSessionTable.h"
+#include "Mcp/SlateAgentBridgeMcpToolRegistry.h"
 
 class FSlateAgentBridgeLiveCodingManager;
+class FSlateAgentBridgeMcpLiveCodingTools;
 class FSlateAgentBridgeMcpSession;
+class FSlateAgentBridgeMcpToolDispatcher;
+class FJsonValue;
 class IHttpRouter;
+struct FHttpServerResponse;
+struct FSlateAgentBridgeCompileEvent;
+struct FSlateAgentBridgeMcpEvent;
 
 class FSlateAgentBridgeMcpServer
 {
 public:
-	FSlateAgentBridgeMcpServer(FSlateAgentBridgeLiveCodingManager& InLiveCodingManager, uint32 InPort, const FString& InBindAddress);
+	FSlateAgentBridgeMcpServer(const TSharedRef<FSlateAgentBridgeLiveCodingManager>& InLiveCodingManager, uint32 InPort, const FString& InBindAddress);
 	~FSlateAgentBridgeMcpServer();
 
 	bool Start();
@@ -23,6 +32,44 @@ public:
 private:
 	bool HandlePostRequest(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
 	bool HandleGetRequest(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
+	bool HandleDeleteRequest(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
+
+	/** A GET /mcp held open until the session has events to deliver or the poll window ends. */
+	struct FPendingEventStream
+	{
+		FGuid SessionId;
+		uint64 LastEventId = 0;
+		double DeadlineSeconds = 0.0;
+		FHttpResultCallback OnComplete;
+	};
+
+	/** A liveCoding.compile call with waitForCompletion, answered when its compile is finalized. */
+	struct FPendingCompileWait
+	{
+		FGuid SessionId;
+		TSharedPtr<FJsonValue> IdValue;
+		uint64 TicketId = 0;
+		uint64 CompileGeneration = 0;
+		double TimeoutSeconds = 0.0;
+		double DeadlineSeconds = 0.0;
+		bool bRespondAsSse = false;
+		FName ContentEncoding;
+		FHttpResultCallback OnComplete;
+	};
+
+	void HandleCompileEvent(const FSlateAgentBridgeCompileEvent& Event);
+	void HandleToolsChanged();
+	bool TickDeferredResponses(float DeltaTime);
+	FName NegotiateContentEncoding(const FHttpServerRequest& Request) const;
+
+	/** Hands a POST reply to OnComplete, compressing it on a worker first when that was negotiated. */
+	void CompleteResponse(TUniquePtr<FHttpServerResponse> Response, FName ContentEncoding, const FHttpResultCallback& OnComplete);
+	void CompleteCompileWaits(bool bForceAll);
+	bool TryCompleteEventStream(FPendingEventStream& Pending, bool bForce);
+	void CompleteAllEventStreams();
+	void EvictIdleSessions();
+	void CloseSession(const FGuid& SessionId, const TSharedPtr<FSlateAgentBridgeMcpSession>& Session, const TCHAR* Reason);
+	bool HasHeldResponses(const FGuid& SessionId) const;
 	TSharedPtr<FSlateAgentBridgeMcpSession> FindSessionById(const FGuid& ClientId);
 	TSharedPtr<FSlateAgentBridgeMcpSession> CreateSession(const FString& Endpoint, FGuid& OutSessionId);
 	TSharedPtr<FSlateAgentBridgeMcpSession> FindSessionForEndpoint(const FString& Endpoint, FGuid& OutSessionId);
@@ -33,7 +80,7 @@ private:
 	static bool TryParseSessionId(const FString& RawValue, FGuid& OutSessionId);
 	static FString ExtractHeaderValue(const TMap<FString, TArray<FString>>& Headers, const FString& HeaderName);
 
-	FSlateAgentBridgeLiveCodingManager& LiveCodingManager;
+	TSharedRef<FSlateAgentBridgeLiveCodingManager> LiveCodingManager;
 	uint32 Port;
 	FString BindAddress;
 	FString EndpointPath;
@@ -41,9 +88,27 @@ private:
 	TSharedPtr<IHttpRouter> Router;
 	FHttpRouteHandle PostRouteHandle;
 	FHttpRouteHandle GetRouteHandle;
+	FHttpRouteHandle DeleteRouteHandle;
 	bool bListenersStarted;
 
-	FCriticalSection SessionMutex;
-	TMap<FGuid, TSharedPtr<FSlateAgentBridgeMcpSession>> Sessions;
-	TMap<FString, FGuid> EndpointToSession;
+	FSlateAgentBridgeMcpToolRegistry ToolRegistry;
+	FDelegateHandle ToolsChangedHandle;
+	TSharedRef<FSlateAgentBridgeMcpLiveCodingTools> LiveCodingTools;
+	TSharedRef<FSlateAgentBridgeMcpToolDispatcher> ToolDispatcher;
+
+	FSlateAgentBridgeMcpSessionTable SessionTable;
+
+	/** Sessions without a request for this long are closed; 0 disables expiry. */
+	double SessionIdleTimeoutSeconds;
+	double NextSessionSweepSeconds;
+
+	/** Opt-in gzip/deflate for POST replies; smaller bodies are sent uncompressed. */
+	bool bResponseCompressionEnabled;
+	int32 CompressionThresholdBytes;
+
+	/** Held responses; only touched from the game thread, where the HTTP server dispatches. */
+	TArray<FPendingEventStream> PendingEventStreams;
+	TArray<FPendingCompileWait> PendingCompileWaits;
+	FTSTicker::FDelegateHandle EventStreamTickerHandle;
+	FDelegateHandle CompileEventHandle;
 };
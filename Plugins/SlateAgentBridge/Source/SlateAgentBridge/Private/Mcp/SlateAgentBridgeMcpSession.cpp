@@ -1,16 +1,14 @@
 #include "Mcp/SlateAgentBridgeMcpSession.h"
 
-#include "LiveCoding/SlateAgentBridgeLiveCodingManager.h"
-#include "SlateAgentBridgeLiveCodingTypes.h"
+#include "Mcp/SlateAgentBridgeMcpResponseBody.h"
+#include "Mcp/SlateAgentBridgeMcpToolRegistry.h"
+#include "Mcp/SlateAgentBridgeUtf8JsonWriter.h"
 #include "SlateAgentBridgeLog.h"
 
 #include "Dom/JsonObject.h"
 #include "Dom/JsonValue.h"
-#include "Containers/StringConv.h"
+#include "Async/ParallelFor.h"
 #include "Misc/ScopeLock.h"
-#include "Serialization/JsonSerializer.h"
-#include "Serialization/JsonWriter.h"
-#include "ILiveCodingModule.h"
 
 namespace SlateAgentBridge::Mcp
 {
@@ -20,58 +18,152 @@ namespace SlateAgentBridge::Mcp
 	static const TCHAR* PingMethod = TEXT("ping");
 	static const TCHAR* InitializedNotification = TEXT("notifications/initialized");
 
-	static const TCHAR* CompileToolName = TEXT("liveCoding.compile");
-	static const TCHAR* StatusToolName = TEXT("liveCoding.status");
-
 	static const TCHAR* ProtocolVersion = TEXT("2025-06-18");
 }
 
 namespace
 {
-	constexpr int32 JsonRpcParseError = -32700;
 	constexpr int32 JsonRpcInvalidRequest = -32600;
 	constexpr int32 JsonRpcMethodNotFound = -32601;
 	constexpr int32 JsonRpcInvalidParams = -32602;
 	constexpr int32 JsonRpcServerError = -32002;
+
+	/** serverInfo, capabilities and instructions of the initialize result; constant, so encoded once. */
+	const TArray<uint8>& GetEncodedInitializeFields()
+	{
+		static const TArray<uint8> Encoded = []()
+		{
+			TSharedRef<FJsonObject> Fields = MakeShared<FJsonObject>();
+
+			TSharedPtr<FJsonObject> ServerInfo = MakeShared<FJsonObject>();
+			ServerInfo->SetStringField(TEXT("name"), TEXT("SlateAgentBridge"));
+			ServerInfo->SetStringField(TEXT("version"), TEXT("1.0.0"));
+			Fields->SetObjectField(TEXT("serverInfo"), ServerInfo);
+
+			TSharedPtr<FJsonObject> Capabilities = MakeShared<FJsonObject>();
+			TSharedPtr<FJsonObject> ToolsCaps = MakeShared<FJsonObject>();
+			ToolsCaps->SetBoolField(TEXT("listChanged"), true);
+			Capabilities->SetObjectField(TEXT("tools"), ToolsCaps);
+			// Compile log lines are pushed as notifications/message over the GET event stream.
+			Capabilities->SetObjectField(TEXT("logging"), MakeShared<FJsonObject>());
+			Fields->SetObjectField(TEXT("capabilities"), Capabilities);
+
+			Fields->SetStringField(TEXT("instructions"), TEXT("Use tools/list to discover the available Live Coding tools. Call liveCoding.compile to trigger a compile or liveCoding.status for the latest snapshot."));
+
+			// Drop the opening brace; the protocol version is spliced in front per request.
+			TArray<uint8> Bytes = FSlateAgentBridgeUtf8JsonWriter::Encode(*Fields);
+			Bytes.RemoveAt(0);
+			return Bytes;
+		}();
+		return Encoded;
+	}
 }
 
 
-FSlateAgentBridgeMcpSession::FSlateAgentBridgeMcpSession(FSlateAgentBridgeLiveCodingManager& InLiveCodingManager, const FGuid& InClientId, FString InEndpoint)
-	: LiveCodingManager(InLiveCodingManager)
+FSlateAgentBridgeMcpSession::FSlateAgentBridgeMcpSession(const FSlateAgentBridgeMcpToolRegistry& InToolRegistry, const FGuid& InClientId, FString InEndpoint)
+	: ToolRegistry(InToolRegistry)
 	, ClientId(InClientId)
 	, Endpoint(MoveTemp(InEndpoint))
 	, bInitialized(false)
+	, LastActivityCycles(FPlatformTime::Cycles64())
 {
 }
 
-bool FSlateAgentBridgeMcpSession::HandleMessage(const FString& Message, TArray<FString>& OutgoingMessages)
+void FSlateAgentBridgeMcpBatchResponses::AppendTo(FSlateAgentBridgeMcpResponseBody& Body) const
+{
+	for (const TArray<uint8>& Slot : Slots)
+	{
+		if (!Slot.IsEmpty())
+		{
+			Body.AppendMessage(Slot);
+		}
+	}
+}
+
+bool FSlateAgentBridgeMcpSession::HandleMessage(const TSharedRef<FJsonObject>& Message, FSlateAgentBridgeMcpResponseBody& OutBody, TArray<FSlateAgentBridgeMcpToolInvocation>& OutToolInvocations)
 {
 	FScopeLock Guard(&SessionMutex);
-	PendingMessages.Reset();
+	CurrentBody = &OutBody;
+	CurrentToolInvocations = &OutToolInvocations;
+	bCurrentCanHoldResponse = true;
 	ProcessMessage(Message);
-	OutgoingMessages = PendingMessages;
-	PendingMessages.Reset();
+	bCurrentCanHoldResponse = false;
+	CurrentToolInvocations = nullptr;
+	CurrentBody = nullptr;
+	return true;
+}
+
+bool FSlateAgentBridgeMcpSession::HandleBatch(const TArray<TSharedPtr<FJsonValue>>& Entries, FSlateAgentBridgeMcpBatchResponses& OutResponses)
+{
+	FScopeLock Guard(&SessionMutex);
+
+	if (Entries.IsEmpty())
+	{
+		FSlateAgentBridgeUtf8JsonWriter SlotWriter(OutResponses.Slots.AddDefaulted_GetRef());
+		WriteError(SlotWriter, nullptr, JsonRpcInvalidRequest, TEXT("Batch must contain at least one request."));
+		return true;
+	}
+
+	// Entries finish out of order, so each is encoded into its own slot and appended in batch order.
+	TArray<TArray<uint8>>& Slots = OutResponses.Slots;
+	Slots.SetNum(Entries.Num());
+	TArray<int32> ReadOnlyIndices;
+
+	for (int32 Index = 0; Index < Entries.Num(); ++Index)
+	{
+		const TSharedPtr<FJsonValue>& Entry = Entries[Index];
+		if (!Entry.IsValid() || Entry->Type != EJson::Object)
+		{
+			FSlateAgentBridgeUtf8JsonWriter SlotWriter(Slots[Index]);
+			WriteError(SlotWriter, nullptr, JsonRpcInvalidRequest, TEXT("Batch entries must be JSON-RPC request objects."));
+			continue;
+		}
+
+		const TSharedRef<FJsonObject> Object = Entry->AsObject().ToSharedRef();
+
+		// bInitialized is checked in batch order so an initialize earlier in the batch counts.
+		if (bInitialized && IsReadOnlyRequest(*Object))
+		{
+			ReadOnlyIndices.Add(Index);
+			continue;
+		}
+
+		FSlateAgentBridgeMcpResponseBody SlotBody(ESlateAgentBridgeMcpBodyFraming::Json);
+		const int32 NumToolInvocations = OutResponses.ToolInvocations.Num();
+		CurrentBody = &SlotBody;
+		CurrentToolInvocations = &OutResponses.ToolInvocations;
+		ProcessMessage(Object);
+		CurrentToolInvocations = nullptr;
+		CurrentBody = nullptr;
+		Slots[Index] = SlotBody.Finish();
+
+		// A resolved tools/call leaves its slot empty until the dispatched call completes.
+		if (OutResponses.ToolInvocations.Num() > NumToolInvocations)
+		{
+			OutResponses.ToolSlots.Add(Index);
+		}
+	}
+
+	ParallelFor(ReadOnlyIndices.Num(), [this, &Entries, &Slots, &ReadOnlyIndices](int32 WorkIndex)
+	{
+		const int32 EntryIndex = ReadOnlyIndices[WorkIndex];
+		Slots[EntryIndex] = BuildReadOnlyResponse(*Entries[EntryIndex]->AsObject());
+	}, ReadOnlyIndices.Num() < 2 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+	const FString ClientIdString = ClientId.ToString();
+	UE_LOG(LogSlateAgentBridge, Verbose, TEXT("MCP client %s batch: %d entries, %d read-only in parallel, %d tool call(s) to dispatch."),
+		*ClientIdString, Entries.Num(), ReadOnlyIndices.Num(), OutResponses.ToolInvocations.Num());
 	return true;
 }
 
 void FSlateAgentBridgeMcpSession::HandleClosed()
 {
 	bInitialized = false;
-	PendingMessages.Reset();
+	EventStream.Reset();
 }
 
-void FSlateAgentBridgeMcpSession::ProcessMessage(const FString& Message)
+void FSlateAgentBridgeMcpSession::ProcessMessage(const TSharedRef<FJsonObject>& Object)
 {
-	TSharedPtr<FJsonObject> Object;
-	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Message);
-	if (!FJsonSerializer::Deserialize(Reader, Object) || !Object.IsValid())
-	{
-		const FString ClientIdString = ClientId.ToString();
-		UE_LOG(LogSlateAgentBridge, Warning, TEXT("Received invalid JSON from MCP client %s"), *ClientIdString);
-		SendParseError();
-		return;
-	}
-
 	TSharedPtr<FJsonValue> IdValue = Object->TryGetField(TEXT("id"));
 
 	FString JsonRpcVersion;
@@ -137,6 +229,44 @@ void FSlateAgentBridgeMcpSession::ProcessMessage(const FString& Message)
 	}
 }
 
+bool FSlateAgentBridgeMcpSession::IsReadOnlyRequest(const FJsonObject& Object) const
+{
+	FString JsonRpcVersion;
+	if (!Object.TryGetStringField(TEXT("jsonrpc"), JsonRpcVersion) || JsonRpcVersion != TEXT("2.0") || !Object.HasField(TEXT("id")))
+	{
+		return false;
+	}
+
+	FString Method;
+	if (!Object.TryGetStringField(TEXT("method"), Method))
+	{
+		return false;
+	}
+
+	// Tool calls are never evaluated here; they go through the dispatcher, which honours their policies.
+	return Method == SlateAgentBridge::Mcp::PingMethod || Method == SlateAgentBridge::Mcp::ToolsListMethod;
+}
+
+TArray<uint8> FSlateAgentBridgeMcpSession::BuildReadOnlyResponse(const FJsonObject& Object) const
+{
+	const TSharedPtr<FJsonValue> IdValue = Object.TryGetField(TEXT("id"));
+
+	FString Method;
+	Object.TryGetStringField(TEXT("method"), Method);
+
+	TArray<uint8> Encoded;
+	FSlateAgentBridgeUtf8JsonWriter Writer(Encoded);
+
+	if (Method == SlateAgentBridge::Mcp::PingMethod)
+	{
+		WriteResponse(Writer, IdValue, FJsonObject());
+		return Encoded;
+	}
+
+	WriteEncodedResponse(Writer, IdValue, *ToolRegistry.GetEncodedToolsList());
+	return Encoded;
+}
+
 void FSlateAgentBridgeMcpSession::RespondInitialize(const TSharedPtr<FJsonValue>& IdValue, const TSharedPtr<FJsonObject>& Params)
 {
 	FString RequestedProtocol = SlateAgentBridge::Mcp::ProtocolVersion;
@@ -149,23 +279,14 @@ void FSlateAgentBridgeMcpSession::RespondInitialize(const TSharedPtr<FJsonValue>
 		}
 	}
 
-	TSharedRef<FJsonObject> Result = MakeShared<FJsonObject>();
-	Result->SetStringField(TEXT("protocolVersion"), RequestedProtocol);
-
-	TSharedPtr<FJsonObject> ServerInfo = MakeShared<FJsonObject>();
-	ServerInfo->SetStringField(TEXT("name"), TEXT("SlateAgentBridge"));
-	ServerInfo->SetStringField(TEXT("version"), TEXT("1.0.0"));
-	Result->SetObjectField(TEXT("serverInfo"), ServerInfo);
-
-	TSharedPtr<FJsonObject> Capabilities = MakeShared<FJsonObject>();
-	TSharedPtr<FJsonObject> ToolsCaps = MakeShared<FJsonObject>();
-	ToolsCaps->SetBoolField(TEXT("listChanged"), false);
-	Capabilities->SetObjectField(TEXT("tools"), ToolsCaps);
-	Result->SetObjectField(TEXT("capabilities"), Capabilities);
-
-	Result->SetStringField(TEXT("instructions"), TEXT("Use tools/list to discover the available Live Coding tools. Call liveCoding.compile to trigger a compile or liveCoding.status for the latest snapshot."));
-
-	SendResponse(IdValue, Result);
+	FSlateAgentBridgeUtf8JsonWriter& Writer = CurrentBody->BeginMessage();
+	WriteResponseHead(Writer, IdValue);
+	Writer.WriteRaw("{\"protocolVersion\":");
+	Writer.WriteString(RequestedProtocol);
+	Writer.WriteRaw(",");
+	Writer.WriteRawUtf8(GetEncodedInitializeFields());
+	Writer.WriteRaw("}");
+	CurrentBody->EndMessage();
 
 	bInitialized = true;
 
@@ -175,13 +296,8 @@ void FSlateAgentBridgeMcpSession::RespondInitialize(const TSharedPtr<FJsonValue>
 
 void FSlateAgentBridgeMcpSession::RespondToolsList(const TSharedPtr<FJsonValue>& IdValue)
 {
-	TArray<TSharedPtr<FJsonValue>> Tools;
-	PopulateToolsList(Tools);
-
-	TSharedRef<FJsonObject> Result = MakeShared<FJsonObject>();
-	Result->SetArrayField(TEXT("tools"), Tools);
-
-	SendResponse(IdValue, Result);
+	WriteEncodedResponse(CurrentBody->BeginMessage(), IdValue, *ToolRegistry.GetEncodedToolsList());
+	CurrentBody->EndMessage();
 }
 
 void FSlateAgentBridgeMcpSession::RespondToolsCall(const TSharedPtr<FJsonValue>& IdValue, const TSharedPtr<FJsonObject>& Params)
@@ -199,334 +315,114 @@ void FSlateAgentBridgeMcpSession::RespondToolsCall(const TSharedPtr<FJsonValue>&
 		return;
 	}
 
-	if (ToolName == SlateAgentBridge::Mcp::CompileToolName)
+	TSharedPtr<FJsonObject> Arguments;
+	if (Params->HasTypedField<EJson::Object>(TEXT("arguments")))
 	{
-		HandleCompileTool(IdValue);
+		Arguments = Params->GetObjectField(TEXT("arguments"));
 	}
-	else if (ToolName == SlateAgentBridge::Mcp::StatusToolName)
-	{
-		HandleStatusTool(IdValue);
-	}
-	else
-	{
-		SendError(IdValue, JsonRpcMethodNotFound, FString::Printf(TEXT("Unknown tool '%s'."), *ToolName));
-	}
-}
 
-void FSlateAgentBridgeMcpSession::RespondPing(const TSharedPtr<FJsonValue>& IdValue)
-{
-	TSharedRef<FJsonObject> Result = MakeShared<FJsonObject>();
-	SendResponse(IdValue, Result);
-}
-
-void FSlateAgentBridgeMcpSession::HandleCompileTool(const TSharedPtr<FJsonValue>& IdValue)
-{
-	FString ErrorMessage;
-	if (!LiveCodingManager.TryBeginCompile(ErrorMessage))
+	TSharedPtr<const FSlateAgentBridgeMcpRegisteredTool> Tool = ToolRegistry.FindTool(ToolName);
+	if (!Tool.IsValid())
 	{
-		TSharedRef<FJsonObject> Structured = MakeShared<FJsonObject>();
-		Structured->SetStringField(TEXT("status"), TEXT("error"));
-		Structured->SetStringField(TEXT("message"), ErrorMessage);
-		Structured->SetBoolField(TEXT("compileInProgress"), true);
-		Structured->SetBoolField(TEXT("compileStarted"), false);
-		SendToolResult(IdValue, ErrorMessage, Structured, true);
+		SendError(IdValue, JsonRpcMethodNotFound, FString::Printf(TEXT("Unknown tool '%s'."), *ToolName));
 		return;
 	}
 
-	FString StatusMessage;
-	TSharedRef<FJsonObject> Structured = BuildLiveCodingStatus(StatusMessage);
-	StatusMessage = TEXT("Compile queued. Poll liveCoding.status for updates.");
-	Structured->SetStringField(TEXT("status"), TEXT("ok"));
-	Structured->SetStringField(TEXT("message"), StatusMessage);
-	Structured->SetBoolField(TEXT("compileStarted"), true);
-
-	SendToolResult(IdValue, StatusMessage, Structured, false);
+	FSlateAgentBridgeMcpToolCall Call;
+	Call.IdValue = IdValue;
+	Call.Arguments = Arguments;
+	Call.ClientId = ClientId;
 
-	FSlateAgentBridgeLiveCodingManager* ManagerPtr = &LiveCodingManager;
-	AsyncTask(ENamedThreads::GameThread, [ManagerPtr]()
-	{
-		ManagerPtr->ExecuteCompileOnGameThread();
-	});
+	Call.bCanHoldResponse = bCurrentCanHoldResponse;
 
-	const FString ClientIdString = ClientId.ToString();
-	UE_LOG(LogSlateAgentBridge, Verbose, TEXT("MCP client %s queued Live Coding compile."), *ClientIdString);
+	// The server dispatches the call, so it leaves the session lock and runs per the tool's policies.
+	CurrentToolInvocations->Add({ MoveTemp(Tool), MoveTemp(Call) });
 }
 
-void FSlateAgentBridgeMcpSession::HandleStatusTool(const TSharedPtr<FJsonValue>& IdValue)
-{
-	FString StatusMessage;
-	TSharedRef<FJsonObject> Structured = BuildLiveCodingStatus(StatusMessage);
-	SendToolResult(IdValue, StatusMessage, Structured, false);
-
-	const FString ClientIdString = ClientId.ToString();
-	UE_LOG(LogSlateAgentBridge, Verbose, TEXT("MCP client %s requested Live Coding status."), *ClientIdString);
-}
-
-void FSlateAgentBridgeMcpSession::SendToolResult(const TSharedPtr<FJsonValue>& IdValue, const FString& MessageText, const TSharedRef<FJsonObject>& Structured, bool bIsError)
+void FSlateAgentBridgeMcpSession::RespondPing(const TSharedPtr<FJsonValue>& IdValue)
 {
-	TSharedRef<FJsonObject> ResultObject = MakeShared<FJsonObject>();
-	ResultObject->SetArrayField(TEXT("content"), MakeTextContentArray(MessageText.IsEmpty() ? TEXT(" ") : MessageText));
-	ResultObject->SetObjectField(TEXT("structuredContent"), Structured);
-	if (bIsError)
-	{
-		ResultObject->SetBoolField(TEXT("isError"), true);
-	}
-
-	SendResponse(IdValue, ResultObject);
+	SendResponse(IdValue, MakeShared<FJsonObject>());
 }
 
 void FSlateAgentBridgeMcpSession::SendResponse(const TSharedPtr<FJsonValue>& IdValue, const TSharedRef<FJsonObject>& ResultObject)
 {
-	TSharedRef<FJsonObject> Response = MakeShared<FJsonObject>();
-	Response->SetStringField(TEXT("jsonrpc"), TEXT("2.0"));
-	WriteIdField(IdValue, Response);
-	Response->SetObjectField(TEXT("result"), ResultObject);
-
-	SendJson(Response);
+	WriteResponse(CurrentBody->BeginMessage(), IdValue, *ResultObject);
+	CurrentBody->EndMessage();
 }
 
 void FSlateAgentBridgeMcpSession::SendError(const TSharedPtr<FJsonValue>& IdValue, int32 Code, const FString& ErrorMessage, const TSharedPtr<FJsonObject>& Data)
 {
-	TSharedRef<FJsonObject> ErrorObject = MakeShared<FJsonObject>();
-	ErrorObject->SetNumberField(TEXT("code"), Code);
-	ErrorObject->SetStringField(TEXT("message"), ErrorMessage);
-	if (Data.IsValid())
-	{
-		ErrorObject->SetObjectField(TEXT("data"), Data.ToSharedRef());
-	}
-
-	TSharedRef<FJsonObject> Response = MakeShared<FJsonObject>();
-	Response->SetStringField(TEXT("jsonrpc"), TEXT("2.0"));
-	WriteIdField(IdValue, Response);
-	Response->SetObjectField(TEXT("error"), ErrorObject);
-
-	SendJson(Response);
+	WriteError(CurrentBody->BeginMessage(), IdValue, Code, ErrorMessage, Data);
+	CurrentBody->EndMessage();
 }
 
-void FSlateAgentBridgeMcpSession::SendParseError()
+void FSlateAgentBridgeMcpSession::WriteToolResult(FSlateAgentBridgeUtf8JsonWriter& Writer, const TSharedPtr<FJsonValue>& IdValue, const FSlateAgentBridgeMcpToolResult& Result)
 {
-	SendError(TSharedPtr<FJsonValue>(), JsonRpcParseError, TEXT("Failed to parse JSON-RPC message."));
-}
-
-void FSlateAgentBridgeMcpSession::SendJson(const TSharedRef<FJsonObject>& Object)
-{
-	FString Payload;
-	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Payload);
-	FJsonSerializer::Serialize(Object, Writer);
-
-	PendingMessages.Add(MoveTemp(Payload));
-}
-
-void FSlateAgentBridgeMcpSession::WriteIdField(const TSharedPtr<FJsonValue>& IdValue, const TSharedRef<FJsonObject>& Target) const
-{
-	if (!IdValue.IsValid())
+	// Streamed field by field so the structured payload is serialized once, without a wrapper DOM.
+	WriteResponseHead(Writer, IdValue);
+	Writer.WriteRaw("{\"content\":[{\"type\":\"text\",\"text\":");
+	Writer.WriteString(Result.Message.IsEmpty() ? FStringView(TEXT(" ")) : FStringView(Result.Message));
+	Writer.WriteRaw("}],\"structuredContent\":");
+	if (Result.Structured.IsValid())
+	{
+		Writer.WriteObject(*Result.Structured);
+	}
+	else
 	{
-		Target->SetField(TEXT("id"), MakeShared<FJsonValueNull>());
-		return;
+		Writer.WriteRaw("{}");
 	}
-
-	switch (IdValue->Type)
+	if (Result.bIsError)
 	{
-	case EJson::String:
-		Target->SetStringField(TEXT("id"), IdValue->AsString());
-		break;
-	case EJson::Number:
-		Target->SetNumberField(TEXT("id"), IdValue->AsNumber());
-		break;
-	case EJson::Null:
-		Target->SetField(TEXT("id"), MakeShared<FJsonValueNull>());
-		break;
-	case EJson::Boolean:
-		Target->SetBoolField(TEXT("id"), IdValue->AsBool());
-		break;
-	case EJson::Array:
-	case EJson::Object:
-		Target->SetField(TEXT("id"), IdValue);
-		break;
+		Writer.WriteRaw(",\"isError\":true");
 	}
+	Writer.WriteRaw("}}");
 }
 
-TArray<TSharedPtr<FJsonValue>> FSlateAgentBridgeMcpSession::MakeTextContentArray(const FString& MessageText) const
+void FSlateAgentBridgeMcpSession::WriteResponseHead(FSlateAgentBridgeUtf8JsonWriter& Writer, const TSharedPtr<FJsonValue>& IdValue)
 {
-	TArray<TSharedPtr<FJsonValue>> Content;
-	TSharedRef<FJsonObject> ContentObject = MakeShared<FJsonObject>();
-	ContentObject->SetStringField(TEXT("type"), TEXT("text"));
-	ContentObject->SetStringField(TEXT("text"), MessageText);
-	Content.Add(MakeShared<FJsonValueObject>(ContentObject));
-	return Content;
+	Writer.WriteRaw("{\"jsonrpc\":\"2.0\",\"id\":");
+	Writer.WriteValue(IdValue);
+	Writer.WriteRaw(",\"result\":");
 }
 
-TSharedRef<FJsonObject> FSlateAgentBridgeMcpSession::BuildLiveCodingStatus(FString& OutMessage) const
+void FSlateAgentBridgeMcpSession::WriteResponse(FSlateAgentBridgeUtf8JsonWriter& Writer, const TSharedPtr<FJsonValue>& IdValue, const FJsonObject& ResultObject)
 {
-	TArray<FSlateAgentBridgeLogEntry> LogSnapshot;
-	FDateTime SnapshotTimestamp;
-	ELiveCodingCompileResult SnapshotResult = ELiveCodingCompileResult::NotStarted;
-	bool bHasSnapshotResult = false;
-	FString SnapshotError;
-	bool bInProgress = false;
-
-	LiveCodingManager.GetLastCompileSnapshot(LogSnapshot, SnapshotTimestamp, SnapshotResult, bHasSnapshotResult, SnapshotError, bInProgress);
-
-	TSharedRef<FJsonObject> Status = MakeShared<FJsonObject>();
-	const FString ResultString = FSlateAgentBridgeLiveCodingManager::CompileResultToString(SnapshotResult);
-
-	Status->SetStringField(TEXT("status"), SnapshotError.IsEmpty() ? TEXT("ok") : TEXT("error"));
-	Status->SetStringField(TEXT("compileResult"), ResultString);
-	Status->SetBoolField(TEXT("compileInProgress"), bInProgress);
-	Status->SetBoolField(TEXT("hasPreviousResult"), bHasSnapshotResult);
-	Status->SetBoolField(TEXT("compileStarted"), false);
-
-	if (SnapshotTimestamp.GetTicks() > 0)
-	{
-		Status->SetStringField(TEXT("timestampUtc"), SnapshotTimestamp.ToIso8601());
-	}
-
-	if (!SnapshotError.IsEmpty())
-	{
-		OutMessage = SnapshotError;
-	}
-	else if (bInProgress)
-	{
-		OutMessage = TEXT("Compile in progress.");
-	}
-	else if (!bHasSnapshotResult)
-	{
-		OutMessage = TEXT("No compile has been executed yet.");
-	}
-	else
-	{
-		OutMessage = FString::Printf(TEXT("Last compile result: %s."), *ResultString);
-	}
-
-	Status->SetStringField(TEXT("message"), OutMessage);
-
-	TArray<TSharedPtr<FJsonValue>> LogArray;
-	LogArray.Reserve(LogSnapshot.Num());
-	for (const FSlateAgentBridgeLogEntry& Entry : LogSnapshot)
-	{
-		TSharedRef<FJsonObject> EntryObject = MakeShared<FJsonObject>();
-		EntryObject->SetStringField(TEXT("timeUtc"), Entry.Timestamp.ToIso8601());
-		EntryObject->SetStringField(TEXT("category"), Entry.Category);
-		EntryObject->SetStringField(TEXT("verbosity"), Entry.Verbosity);
-		EntryObject->SetStringField(TEXT("message"), Entry.Message);
-		LogArray.Add(MakeShared<FJsonValueObject>(EntryObject));
-	}
-	Status->SetArrayField(TEXT("log"), LogArray);
-
-	return Status;
+	WriteResponseHead(Writer, IdValue);
+	Writer.WriteObject(ResultObject);
+	Writer.WriteRaw("}");
 }
 
-TSharedRef<FJsonObject> FSlateAgentBridgeMcpSession::BuildToolInputSchema(bool bIncludeWaitFlag) const
+void FSlateAgentBridgeMcpSession::WriteEncodedResponse(FSlateAgentBridgeUtf8JsonWriter& Writer, const TSharedPtr<FJsonValue>& IdValue, TConstArrayView<uint8> EncodedResult)
 {
-	TSharedRef<FJsonObject> Schema = MakeShared<FJsonObject>();
-	Schema->SetStringField(TEXT("type"), TEXT("object"));
-
-	TSharedPtr<FJsonObject> Properties = MakeShared<FJsonObject>();
-	if (bIncludeWaitFlag)
-	{
-		TSharedRef<FJsonObject> WaitProp = MakeShared<FJsonObject>();
-		WaitProp->SetStringField(TEXT("type"), TEXT("boolean"));
-		WaitProp->SetStringField(TEXT("description"), TEXT("Reserved for future use. When true, the server will wait for the compile to finish before responding."));
-		Properties->SetObjectField(TEXT("waitForCompletion"), WaitProp);
-	}
-	Schema->SetObjectField(TEXT("properties"), Properties);
-	Schema->SetBoolField(TEXT("additionalProperties"), false);
-
-	return Schema;
+	WriteResponseHead(Writer, IdValue);
+	Writer.WriteRawUtf8(EncodedResult);
+	Writer.WriteRaw("}");
 }
 
-TSharedRef<FJsonObject> FSlateAgentBridgeMcpSession::BuildLiveCodingOutputSchema() const
+void FSlateAgentBridgeMcpSession::WriteError(FSlateAgentBridgeUtf8JsonWriter& Writer, const TSharedPtr<FJsonValue>& IdValue, int32 Code, const FString& ErrorMessage, const TSharedPtr<FJsonObject>& Data)
 {
-	TSharedRef<FJsonObject> Schema = MakeShared<FJsonObject>();
-	Schema->SetStringField(TEXT("type"), TEXT("object"));
-
-	TSharedPtr<FJsonObject> Properties = MakeShared<FJsonObject>();
-
-	auto MakeStringProperty = [](const FString& Description)
-	{
-		TSharedRef<FJsonObject> Prop = MakeShared<FJsonObject>();
-		Prop->SetStringField(TEXT("type"), TEXT("string"));
-		if (!Description.IsEmpty())
-		{
-			Prop->SetStringField(TEXT("description"), Description);
-		}
-		return Prop;
-	};
-
-	auto MakeBooleanProperty = [](const FString& Description)
+	Writer.WriteRaw("{\"jsonrpc\":\"2.0\",\"id\":");
+	Writer.WriteValue(IdValue);
+	Writer.WriteRaw(",\"error\":{\"code\":");
+	Writer.WriteNumber(Code);
+	Writer.WriteRaw(",\"message\":");
+	Writer.WriteString(ErrorMessage);
+	if (Data.IsValid())
 	{
-		TSharedRef<FJsonObject> Prop = MakeShared<FJsonObject>();
-		Prop->SetStringField(TEXT("type"), TEXT("boolean"));
-		if (!Description.IsEmpty())
-		{
-			Prop->SetStringField(TEXT("description"), Description);
-		}
-		return Prop;
-	};
-
-	Properties->SetObjectField(TEXT("status"), MakeStringProperty(TEXT("High-level status of the call (ok, error, etc.).")));
-	Properties->SetObjectField(TEXT("message"), MakeStringProperty(TEXT("Human-readable summary of the snapshot.")));
-	Properties->SetObjectField(TEXT("compileResult"), MakeStringProperty(TEXT("Final Live Coding compile result.")));
-	Properties->SetObjectField(TEXT("compileInProgress"), MakeBooleanProperty(TEXT("True if a compile is currently running.")));
-	Properties->SetObjectField(TEXT("hasPreviousResult"), MakeBooleanProperty(TEXT("True if a previous compile result is available.")));
-	Properties->SetObjectField(TEXT("compileStarted"), MakeBooleanProperty(TEXT("True if the request queued a new compile.")));
-	Properties->SetObjectField(TEXT("timestampUtc"), MakeStringProperty(TEXT("UTC timestamp of the snapshot when available.")));
-
-	TSharedRef<FJsonObject> LogItems = MakeShared<FJsonObject>();
-	LogItems->SetStringField(TEXT("type"), TEXT("object"));
-	TSharedPtr<FJsonObject> LogProperties = MakeShared<FJsonObject>();
-	LogProperties->SetObjectField(TEXT("timeUtc"), MakeStringProperty(TEXT("Timestamp of the log entry in UTC.")));
-	LogProperties->SetObjectField(TEXT("category"), MakeStringProperty(TEXT("Log category.")));
-	LogProperties->SetObjectField(TEXT("verbosity"), MakeStringProperty(TEXT("Verbosity string.")));
-	LogProperties->SetObjectField(TEXT("message"), MakeStringProperty(TEXT("Log message text.")));
-	LogItems->SetObjectField(TEXT("properties"), LogProperties);
-	LogItems->SetBoolField(TEXT("additionalProperties"), false);
-
-	TSharedRef<FJsonObject> LogArray = MakeShared<FJsonObject>();
-	LogArray->SetStringField(TEXT("type"), TEXT("array"));
-	LogArray->SetObjectField(TEXT("items"), LogItems);
-	Properties->SetObjectField(TEXT("log"), LogArray);
-
-	Schema->SetObjectField(TEXT("properties"), Properties);
-
-	TArray<TSharedPtr<FJsonValue>> Required;
-	Required.Add(MakeShared<FJsonValueString>(TEXT("status")));
-	Required.Add(MakeShared<FJsonValueString>(TEXT("message")));
-	Required.Add(MakeShared<FJsonValueString>(TEXT("compileResult")));
-	Required.Add(MakeShared<FJsonValueString>(TEXT("compileInProgress")));
-	Schema->SetArrayField(TEXT("required"), Required);
-	Schema->SetBoolField(TEXT("additionalProperties"), true);
-
-	return Schema;
+		Writer.WriteRaw(",\"data\":");
+		Writer.WriteObject(*Data);
+	}
+	Writer.WriteRaw("}}");
 }
 
-void FSlateAgentBridgeMcpSession::PopulateToolsList(TArray<TSharedPtr<FJsonValue>>& OutTools) const
+TArray<uint8> FSlateAgentBridgeMcpSession::SerializeNotification(const FString& Method, const TSharedRef<FJsonObject>& Params)
 {
-	TSharedRef<FJsonObject> CompileTool = MakeShared<FJsonObject>();
-	CompileTool->SetStringField(TEXT("name"), SlateAgentBridge::Mcp::CompileToolName);
-	CompileTool->SetStringField(TEXT("description"), TEXT("Trigger a UE Live Coding compile and return the latest compile snapshot."));
-	CompileTool->SetObjectField(TEXT("inputSchema"), BuildToolInputSchema(true));
-	CompileTool->SetObjectField(TEXT("outputSchema"), BuildLiveCodingOutputSchema());
-	TSharedPtr<FJsonObject> CompileAnnotations = MakeShared<FJsonObject>();
-	CompileAnnotations->SetBoolField(TEXT("destructiveHint"), false);
-	CompileAnnotations->SetBoolField(TEXT("readOnlyHint"), false);
-	CompileAnnotations->SetStringField(TEXT("title"), TEXT("Trigger Live Coding Compile"));
-	CompileTool->SetObjectField(TEXT("annotations"), CompileAnnotations);
-	OutTools.Add(MakeShared<FJsonValueObject>(CompileTool));
-
-	TSharedRef<FJsonObject> StatusTool = MakeShared<FJsonObject>();
-	StatusTool->SetStringField(TEXT("name"), SlateAgentBridge::Mcp::StatusToolName);
-	StatusTool->SetStringField(TEXT("description"), TEXT("Return the most recent Live Coding compile snapshot without starting a new compile."));
-	StatusTool->SetObjectField(TEXT("inputSchema"), BuildToolInputSchema(false));
-	StatusTool->SetObjectField(TEXT("outputSchema"), BuildLiveCodingOutputSchema());
-	TSharedPtr<FJsonObject> StatusAnnotations = MakeShared<FJsonObject>();
-	StatusAnnotations->SetBoolField(TEXT("destructiveHint"), false);
-	StatusAnnotations->SetBoolField(TEXT("readOnlyHint"), true);
-	StatusAnnotations->SetStringField(TEXT("title"), TEXT("Get Live Coding Status"));
-	StatusTool->SetObjectField(TEXT("annotations"), StatusAnnotations);
-	OutTools.Add(MakeShared<FJsonValueObject>(StatusTool));
+	TArray<uint8> Encoded;
+	FSlateAgentBridgeUtf8JsonWriter Writer(Encoded);
+	Writer.WriteRaw("{\"jsonrpc\":\"2.0\",\"method\":");
+	Writer.WriteString(Method);
+	Writer.WriteRaw(",\"params\":");
+	Writer.WriteObject(*Params);
+	Writer.WriteRaw("}");
+	return Encoded;
 }
-
-
-
-
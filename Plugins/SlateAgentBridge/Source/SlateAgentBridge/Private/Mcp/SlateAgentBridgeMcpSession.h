@@ -2,50 +2,100 @@
 
 #include "CoreMinimal.h"
 #include "HAL/CriticalSection.h"
+#include "HAL/PlatformTime.h"
+#include "Templates/Atomic.h"
+#include "Mcp/SlateAgentBridgeMcpEventStream.h"
+#include "Mcp/SlateAgentBridgeMcpToolRegistry.h"
 
 class FJsonObject;
 class FJsonValue;
-class FSlateAgentBridgeLiveCodingManager;
+class FSlateAgentBridgeMcpResponseBody;
+class FSlateAgentBridgeUtf8JsonWriter;
+
+/** A batch evaluated by the session whose tools/call entries still have to be dispatched. */
+struct FSlateAgentBridgeMcpBatchResponses
+{
+	/** One encoded response per entry, in batch order; empty for notifications and pending tool calls. */
+	TArray<TArray<uint8>> Slots;
+
+	/** The batch's tool calls, and for each the slot its result is written into. */
+	TArray<FSlateAgentBridgeMcpToolInvocation> ToolInvocations;
+	TArray<int32> ToolSlots;
+
+	/** Appends the filled slots to Body in batch order. */
+	void AppendTo(FSlateAgentBridgeMcpResponseBody& Body) const;
+};
 
 class FSlateAgentBridgeMcpSession : public TSharedFromThis<FSlateAgentBridgeMcpSession>
 {
 public:
-	FSlateAgentBridgeMcpSession(FSlateAgentBridgeLiveCodingManager& InLiveCodingManager, const FGuid& InClientId, FString InEndpoint);
+	FSlateAgentBridgeMcpSession(const FSlateAgentBridgeMcpToolRegistry& InToolRegistry, const FGuid& InClientId, FString InEndpoint);
+
+	/**
+	 * Processes a JSON-RPC message that the server has already parsed; the reply, if any, is written
+	 * straight into OutBody. tools/call produces no immediate response: the resolved call is returned
+	 * in OutToolInvocations for the caller to dispatch and answer with WriteToolResult.
+	 */
+	bool HandleMessage(const TSharedRef<FJsonObject>& Message, FSlateAgentBridgeMcpResponseBody& OutBody, TArray<FSlateAgentBridgeMcpToolInvocation>& OutToolInvocations);
 
-	bool HandleMessage(const FString& Message, TArray<FString>& OutgoingMessages);
+	/**
+	 * Processes a JSON-RPC 2.0 batch. Stateful entries run in order; ping and tools/list are evaluated
+	 * in parallel afterwards. Like in HandleMessage, tools/call entries are only resolved: the caller
+	 * dispatches OutResponses.ToolInvocations and writes each result into its slot before replying.
+	 */
+	bool HandleBatch(const TArray<TSharedPtr<FJsonValue>>& Entries, FSlateAgentBridgeMcpBatchResponses& OutResponses);
 	void HandleClosed();
 
 	const FGuid& GetClientId() const { return ClientId; }
+	bool IsInitialized() const { return bInitialized; }
+
+	/** Records client activity; sessions idle past the server's timeout are evicted. */
+	void MarkActive() { LastActivityCycles.Store(FPlatformTime::Cycles64()); }
+	double GetIdleSeconds() const { return FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - LastActivityCycles.Load()); }
 	const FString& GetEndpoint() const { return Endpoint; }
 
+	/** Server-initiated notifications waiting to be delivered over the session's GET stream. */
+	FSlateAgentBridgeMcpEventStream& GetEventStream() { return EventStream; }
+
+	/** Writes the tools/call response carrying a tool's result. */
+	static void WriteToolResult(FSlateAgentBridgeUtf8JsonWriter& Writer, const TSharedPtr<FJsonValue>& IdValue, const FSlateAgentBridgeMcpToolResult& Result);
+
+	/** Encodes a notification once, before it is published to each session's event stream. */
+	static TArray<uint8> SerializeNotification(const FString& Method, const TSharedRef<FJsonObject>& Params);
+
 private:
-	void ProcessMessage(const FString& Message);
+	void ProcessMessage(const TSharedRef<FJsonObject>& Object);
+	bool IsReadOnlyRequest(const FJsonObject& Object) const;
+	TArray<uint8> BuildReadOnlyResponse(const FJsonObject& Object) const;
 	void RespondInitialize(const TSharedPtr<FJsonValue>& IdValue, const TSharedPtr<FJsonObject>& Params);
 	void RespondToolsList(const TSharedPtr<FJsonValue>& IdValue);
 	void RespondToolsCall(const TSharedPtr<FJsonValue>& IdValue, const TSharedPtr<FJsonObject>& Params);
 	void RespondPing(const TSharedPtr<FJsonValue>& IdValue);
 
-	void HandleCompileTool(const TSharedPtr<FJsonValue>& IdValue);
-	void HandleStatusTool(const TSharedPtr<FJsonValue>& IdValue);
-
-	void SendToolResult(const TSharedPtr<FJsonValue>& IdValue, const FString& MessageText, const TSharedRef<FJsonObject>& Structured, bool bIsError);
 	void SendResponse(const TSharedPtr<FJsonValue>& IdValue, const TSharedRef<FJsonObject>& ResultObject);
 	void SendError(const TSharedPtr<FJsonValue>& IdValue, int32 Code, const FString& ErrorMessage, const TSharedPtr<FJsonObject>& Data = nullptr);
-	void SendParseError();
-	void SendJson(const TSharedRef<FJsonObject>& Object);
-	void WriteIdField(const TSharedPtr<FJsonValue>& IdValue, const TSharedRef<FJsonObject>& Target) const;
 
-	TArray<TSharedPtr<FJsonValue>> MakeTextContentArray(const FString& MessageText) const;
-	TSharedRef<FJsonObject> BuildLiveCodingStatus(FString& OutMessage) const;
-	TSharedRef<FJsonObject> BuildToolInputSchema(bool bIncludeWaitFlag) const;
-	TSharedRef<FJsonObject> BuildLiveCodingOutputSchema() const;
-	void PopulateToolsList(TArray<TSharedPtr<FJsonValue>>& OutTools) const;
+	/** Writes {"jsonrpc":"2.0","id":...,"result": and leaves the envelope open for the result. */
+	static void WriteResponseHead(FSlateAgentBridgeUtf8JsonWriter& Writer, const TSharedPtr<FJsonValue>& IdValue);
+	static void WriteResponse(FSlateAgentBridgeUtf8JsonWriter& Writer, const TSharedPtr<FJsonValue>& IdValue, const FJsonObject& ResultObject);
+	static void WriteError(FSlateAgentBridgeUtf8JsonWriter& Writer, const TSharedPtr<FJsonValue>& IdValue, int32 Code, const FString& ErrorMessage, const TSharedPtr<FJsonObject>& Data = nullptr);
+
+	/** Wraps an already encoded result object in a JSON-RPC response without re-serializing it. */
+	static void WriteEncodedResponse(FSlateAgentBridgeUtf8JsonWriter& Writer, const TSharedPtr<FJsonValue>& IdValue, TConstArrayView<uint8> EncodedResult);
 
 private:
-	FSlateAgentBridgeLiveCodingManager& LiveCodingManager;
+	const FSlateAgentBridgeMcpToolRegistry& ToolRegistry;
 	FGuid ClientId;
 	FString Endpoint;
 	bool bInitialized;
-	TArray<FString> PendingMessages;
+
+	/** Body and tool calls of the message being processed; only set while SessionMutex is held. */
+	FSlateAgentBridgeMcpResponseBody* CurrentBody = nullptr;
+	TArray<FSlateAgentBridgeMcpToolInvocation>* CurrentToolInvocations = nullptr;
+
+	/** False while a batch is processed: its reply is one array, which a compile wait cannot hold. */
+	bool bCurrentCanHoldResponse = false;
 	FCriticalSection SessionMutex;
+	FSlateAgentBridgeMcpEventStream EventStream;
+	TAtomic<uint64> LastActivityCycles;
 };
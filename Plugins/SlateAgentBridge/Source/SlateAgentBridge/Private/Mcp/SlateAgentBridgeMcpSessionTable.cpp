@@ -0,0 +1,238 @@
+#include "Mcp/SlateAgentBridgeMcpSessionTable.h"
+
+#include "Mcp/SlateAgentBridgeMcpSession.h"
+
+#include "HAL/PlatformTime.h"
+#include "Misc/ScopeRWLock.h"
+
+FSlateAgentBridgeMcpSessionTable::FSlateAgentBridgeMcpSessionTable(int32 InMaxSessions, int32 InMaxEndpoints)
+	: SessionCount(0)
+	, MaxSessions(FMath::Max(1, InMaxSessions))
+	, MaxEndpoints(FMath::Max(1, InMaxEndpoints))
+{
+}
+
+TSharedPtr<FSlateAgentBridgeMcpSession> FSlateAgentBridgeMcpSessionTable::Find(const FGuid& SessionId) const
+{
+	const FShard& Shard = GetShard(SessionId);
+	FReadScopeLock ReadGuard(Shard.Lock);
+	if (const TSharedPtr<FSlateAgentBridgeMcpSession>* SessionPtr = Shard.Sessions.Find(SessionId))
+	{
+		return *SessionPtr;
+	}
+	return nullptr;
+}
+
+TSharedPtr<FSlateAgentBridgeMcpSession> FSlateAgentBridgeMcpSessionTable::Add(const FGuid& SessionId, const TSharedRef<FSlateAgentBridgeMcpSession>& Session)
+{
+	TSharedPtr<FSlateAgentBridgeMcpSession> Evicted;
+	if (SessionCount.Load() >= MaxSessions)
+	{
+		const FGuid VictimId = FindLeastRecentlyActive();
+		if (VictimId.IsValid())
+		{
+			Evicted = Remove(VictimId);
+		}
+	}
+
+	{
+		FShard& Shard = GetShard(SessionId);
+		FWriteScopeLock WriteGuard(Shard.Lock);
+		if (!Shard.Sessions.Contains(SessionId))
+		{
+			SessionCount.IncrementExchange();
+		}
+		Shard.Sessions.Add(SessionId, Session);
+	}
+
+	return Evicted;
+}
+
+TSharedPtr<FSlateAgentBridgeMcpSession> FSlateAgentBridgeMcpSessionTable::Remove(const FGuid& SessionId)
+{
+	TSharedPtr<FSlateAgentBridgeMcpSession> Removed;
+	{
+		FShard& Shard = GetShard(SessionId);
+		FWriteScopeLock WriteGuard(Shard.Lock);
+		if (Shard.Sessions.RemoveAndCopyValue(SessionId, Removed))
+		{
+			SessionCount.DecrementExchange();
+		}
+	}
+
+	if (Removed.IsValid())
+	{
+		RemoveEndpointsFor(SessionId);
+	}
+	return Removed;
+}
+
+TSharedPtr<FSlateAgentBridgeMcpSession> FSlateAgentBridgeMcpSessionTable::FindSingle(FGuid& OutSessionId) const
+{
+	if (SessionCount.Load() != 1)
+	{
+		return nullptr;
+	}
+
+	for (const FShard& Shard : Shards)
+	{
+		FReadScopeLock ReadGuard(Shard.Lock);
+		for (const TPair<FGuid, TSharedPtr<FSlateAgentBridgeMcpSession>>& Pair : Shard.Sessions)
+		{
+			OutSessionId = Pair.Key;
+			return Pair.Value;
+		}
+	}
+	return nullptr;
+}
+
+TSharedPtr<FSlateAgentBridgeMcpSession> FSlateAgentBridgeMcpSessionTable::FindForEndpoint(const FString& Endpoint, FGuid& OutSessionId) const
+{
+	FGuid SessionId;
+	{
+		FReadScopeLock ReadGuard(EndpointLock);
+		const FEndpointEntry* Entry = EndpointToSession.Find(Endpoint);
+		if (!Entry)
+		{
+			return nullptr;
+		}
+		SessionId = Entry->SessionId;
+		FPlatformAtomics::AtomicStore_Relaxed(&Entry->LastUsedCycles, static_cast<int64>(FPlatformTime::Cycles64()));
+	}
+
+	TSharedPtr<FSlateAgentBridgeMcpSession> Session = Find(SessionId);
+	if (Session.IsValid())
+	{
+		OutSessionId = SessionId;
+	}
+	return Session;
+}
+
+void FSlateAgentBridgeMcpSessionTable::AssociateEndpoint(const FString& Endpoint, const FGuid& SessionId)
+{
+	{
+		// Most requests come from an endpoint that is already mapped; they never take the write lock.
+		FReadScopeLock ReadGuard(EndpointLock);
+		const FEndpointEntry* Entry = EndpointToSession.Find(Endpoint);
+		if (Entry && Entry->SessionId == SessionId)
+		{
+			FPlatformAtomics::AtomicStore_Relaxed(&Entry->LastUsedCycles, static_cast<int64>(FPlatformTime::Cycles64()));
+			return;
+		}
+	}
+
+	FWriteScopeLock WriteGuard(EndpointLock);
+
+	FEndpointEntry& Entry = EndpointToSession.FindOrAdd(Endpoint);
+	Entry.SessionId = SessionId;
+	FPlatformAtomics::AtomicStore_Relaxed(&Entry.LastUsedCycles, static_cast<int64>(FPlatformTime::Cycles64()));
+
+	// Clients reconnect from new ephemeral ports, so the least recently used mappings are dropped first.
+	while (EndpointToSession.Num() > MaxEndpoints)
+	{
+		const FString* OldestEndpoint = nullptr;
+		int64 OldestCycles = MAX_int64;
+		for (const TPair<FString, FEndpointEntry>& Pair : EndpointToSession)
+		{
+			const int64 LastUsedCycles = FPlatformAtomics::AtomicRead_Relaxed(&Pair.Value.LastUsedCycles);
+			if (LastUsedCycles < OldestCycles)
+			{
+				OldestCycles = LastUsedCycles;
+				OldestEndpoint = &Pair.Key;
+			}
+		}
+
+		if (!OldestEndpoint)
+		{
+			break;
+		}
+		EndpointToSession.Remove(FString(*OldestEndpoint));
+	}
+}
+
+void FSlateAgentBridgeMcpSessionTable::GetAll(TArray<TSharedPtr<FSlateAgentBridgeMcpSession>>& OutSessions) const
+{
+	OutSessions.Reset(SessionCount.Load());
+	for (const FShard& Shard : Shards)
+	{
+		FReadScopeLock ReadGuard(Shard.Lock);
+		for (const TPair<FGuid, TSharedPtr<FSlateAgentBridgeMcpSession>>& Pair : Shard.Sessions)
+		{
+			OutSessions.Add(Pair.Value);
+		}
+	}
+}
+
+void FSlateAgentBridgeMcpSessionTable::CollectIdle(double IdleSeconds, TArray<FGuid>& OutSessionIds) const
+{
+	for (const FShard& Shard : Shards)
+	{
+		FReadScopeLock ReadGuard(Shard.Lock);
+		for (const TPair<FGuid, TSharedPtr<FSlateAgentBridgeMcpSession>>& Pair : Shard.Sessions)
+		{
+			if (Pair.Value.IsValid() && Pair.Value->GetIdleSeconds() >= IdleSeconds)
+			{
+				OutSessionIds.Add(Pair.Key);
+			}
+		}
+	}
+}
+
+void FSlateAgentBridgeMcpSessionTable::Reset(TArray<TSharedPtr<FSlateAgentBridgeMcpSession>>& OutSessions)
+{
+	for (FShard& Shard : Shards)
+	{
+		FWriteScopeLock WriteGuard(Shard.Lock);
+		for (TPair<FGuid, TSharedPtr<FSlateAgentBridgeMcpSession>>& Pair : Shard.Sessions)
+		{
+			OutSessions.Add(MoveTemp(Pair.Value));
+		}
+		Shard.Sessions.Empty();
+	}
+	SessionCount.Store(0);
+
+	FWriteScopeLock WriteGuard(EndpointLock);
+	EndpointToSession.Empty();
+}
+
+FSlateAgentBridgeMcpSessionTable::FShard& FSlateAgentBridgeMcpSessionTable::GetShard(const FGuid& SessionId)
+{
+	return Shards[GetTypeHash(SessionId) % ShardCount];
+}
+
+const FSlateAgentBridgeMcpSessionTable::FShard& FSlateAgentBridgeMcpSessionTable::GetShard(const FGuid& SessionId) const
+{
+	return Shards[GetTypeHash(SessionId) % ShardCount];
+}
+
+FGuid FSlateAgentBridgeMcpSessionTable::FindLeastRecentlyActive() const
+{
+	FGuid VictimId;
+	double LongestIdle = -1.0;
+	for (const FShard& Shard : Shards)
+	{
+		FReadScopeLock ReadGuard(Shard.Lock);
+		for (const TPair<FGuid, TSharedPtr<FSlateAgentBridgeMcpSession>>& Pair : Shard.Sessions)
+		{
+			const double IdleSeconds = Pair.Value.IsValid() ? Pair.Value->GetIdleSeconds() : TNumericLimits<double>::Max();
+			if (IdleSeconds > LongestIdle)
+			{
+				LongestIdle = IdleSeconds;
+				VictimId = Pair.Key;
+			}
+		}
+	}
+	return VictimId;
+}
+
+void FSlateAgentBridgeMcpSessionTable::RemoveEndpointsFor(const FGuid& SessionId)
+{
+	FWriteScopeLock WriteGuard(EndpointLock);
+	for (auto It = EndpointToSession.CreateIterator(); It; ++It)
+	{
+		if (It->Value.SessionId == SessionId)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
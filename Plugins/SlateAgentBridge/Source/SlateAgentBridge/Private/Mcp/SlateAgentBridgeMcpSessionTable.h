@@ -0,0 +1,74 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "Misc/Guid.h"
+#include "Templates/Atomic.h"
+
+class FSlateAgentBridgeMcpSession;
+
+/**
+ * Session and endpoint lookup tables for the MCP server. Sessions are spread over a fixed set of
+ * shards, each behind its own reader/writer lock, so concurrent requests for different sessions
+ * only contend on writes. Both tables are bounded: adding past the cap evicts the least recently
+ * active session or the least recently used endpoint mapping.
+ */
+class FSlateAgentBridgeMcpSessionTable
+{
+public:
+	FSlateAgentBridgeMcpSessionTable(int32 InMaxSessions = 64, int32 InMaxEndpoints = 256);
+
+	TSharedPtr<FSlateAgentBridgeMcpSession> Find(const FGuid& SessionId) const;
+
+	/** Adds a session. Returns the session evicted to stay within the cap, if any. */
+	TSharedPtr<FSlateAgentBridgeMcpSession> Add(const FGuid& SessionId, const TSharedRef<FSlateAgentBridgeMcpSession>& Session);
+
+	/** Removes a session and every endpoint mapped to it. */
+	TSharedPtr<FSlateAgentBridgeMcpSession> Remove(const FGuid& SessionId);
+
+	/** The only session when exactly one exists; used for clients that never echo the session header. */
+	TSharedPtr<FSlateAgentBridgeMcpSession> FindSingle(FGuid& OutSessionId) const;
+
+	TSharedPtr<FSlateAgentBridgeMcpSession> FindForEndpoint(const FString& Endpoint, FGuid& OutSessionId) const;
+	void AssociateEndpoint(const FString& Endpoint, const FGuid& SessionId);
+
+	void GetAll(TArray<TSharedPtr<FSlateAgentBridgeMcpSession>>& OutSessions) const;
+
+	/** Ids of sessions that have been idle for at least IdleSeconds. */
+	void CollectIdle(double IdleSeconds, TArray<FGuid>& OutSessionIds) const;
+
+	/** Removes everything and returns the removed sessions. */
+	void Reset(TArray<TSharedPtr<FSlateAgentBridgeMcpSession>>& OutSessions);
+
+	int32 Num() const { return SessionCount.Load(); }
+
+private:
+	static constexpr int32 ShardCount = 8;
+
+	struct FShard
+	{
+		mutable FRWLock Lock;
+		TMap<FGuid, TSharedPtr<FSlateAgentBridgeMcpSession>> Sessions;
+	};
+
+	struct FEndpointEntry
+	{
+		FGuid SessionId;
+
+		/** Refreshed on every lookup, possibly under the shared lock, so it is only accessed atomically. */
+		mutable int64 LastUsedCycles = 0;
+	};
+
+	FShard& GetShard(const FGuid& SessionId);
+	const FShard& GetShard(const FGuid& SessionId) const;
+	FGuid FindLeastRecentlyActive() const;
+	void RemoveEndpointsFor(const FGuid& SessionId);
+
+	FShard Shards[ShardCount];
+	TAtomic<int32> SessionCount;
+	int32 MaxSessions;
+
+	mutable FRWLock EndpointLock;
+	TMap<FString, FEndpointEntry> EndpointToSession;
+	int32 MaxEndpoints;
+};
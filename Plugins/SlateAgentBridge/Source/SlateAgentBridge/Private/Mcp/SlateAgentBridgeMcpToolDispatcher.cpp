@@ -0,0 +1,125 @@
+#include "Mcp/SlateAgentBridgeMcpToolDispatcher.h"
+
+#include "Async/Async.h"
+#include "Misc/ScopeLock.h"
+
+FSlateAgentBridgeMcpToolDispatcher::FSlateAgentBridgeMcpToolDispatcher()
+	: ExclusivePipe(TEXT("SlateAgentBridgeExclusiveTools"))
+	, bGameThreadTaskScheduled(false)
+{
+}
+
+void FSlateAgentBridgeMcpToolDispatcher::Dispatch(FSlateAgentBridgeMcpToolInvocation&& Invocation, FOnToolCompleted&& OnCompleted)
+{
+	check(Invocation.Tool.IsValid());
+
+	if (Invocation.Tool->ThreadAffinity == ESlateAgentBridgeMcpToolThread::GameThread)
+	{
+		// The game thread runs queued calls one after another, which already satisfies Exclusive.
+		EnqueueGameThreadWork([Invocation = MoveTemp(Invocation), OnCompleted = MoveTemp(OnCompleted)]() mutable
+		{
+			OnCompleted(Invocation.Tool->Handler(Invocation.Call));
+		});
+		return;
+	}
+
+	const bool bExclusive = Invocation.Tool->Concurrency == ESlateAgentBridgeMcpToolConcurrency::Exclusive;
+	TWeakPtr<FSlateAgentBridgeMcpToolDispatcher> WeakSelf = AsShared();
+	LaunchWorkerTask([WeakSelf, Invocation = MoveTemp(Invocation), OnCompleted = MoveTemp(OnCompleted)]() mutable
+	{
+		FSlateAgentBridgeMcpToolResult Result = Invocation.Tool->Handler(Invocation.Call);
+		if (TSharedPtr<FSlateAgentBridgeMcpToolDispatcher> Self = WeakSelf.Pin())
+		{
+			Self->EnqueueGameThreadWork([Result = MoveTemp(Result), OnCompleted = MoveTemp(OnCompleted)]() mutable
+			{
+				OnCompleted(MoveTemp(Result));
+			});
+		}
+	}, bExclusive);
+}
+
+void FSlateAgentBridgeMcpToolDispatcher::DispatchWork(TUniqueFunction<void()>&& Work, TUniqueFunction<void()>&& OnCompleted)
+{
+	TWeakPtr<FSlateAgentBridgeMcpToolDispatcher> WeakSelf = AsShared();
+	LaunchWorkerTask([WeakSelf, Work = MoveTemp(Work), OnCompleted = MoveTemp(OnCompleted)]() mutable
+	{
+		Work();
+		if (TSharedPtr<FSlateAgentBridgeMcpToolDispatcher> Self = WeakSelf.Pin())
+		{
+			Self->EnqueueGameThreadWork(MoveTemp(OnCompleted));
+		}
+	}, /*bExclusive=*/false);
+}
+
+void FSlateAgentBridgeMcpToolDispatcher::Flush()
+{
+	check(IsInGameThread());
+
+	// Game-thread work may dispatch more, e.g. a tool result that is then compressed.
+	for (;;)
+	{
+		TArray<UE::Tasks::FTask> Pending;
+		{
+			FScopeLock Guard(&QueueMutex);
+			if (WorkerTasks.IsEmpty() && GameThreadWork.IsEmpty())
+			{
+				break;
+			}
+			Pending = MoveTemp(WorkerTasks);
+			WorkerTasks.Reset();
+		}
+		UE::Tasks::Wait(Pending);
+
+		RunGameThreadWork();
+	}
+}
+
+void FSlateAgentBridgeMcpToolDispatcher::LaunchWorkerTask(TUniqueFunction<void()>&& Work, bool bExclusive)
+{
+	UE::Tasks::FTask Task = bExclusive
+		? ExclusivePipe.Launch(UE_SOURCE_LOCATION, MoveTemp(Work))
+		: UE::Tasks::Launch(UE_SOURCE_LOCATION, MoveTemp(Work));
+
+	FScopeLock Guard(&QueueMutex);
+	WorkerTasks.RemoveAllSwap([](const UE::Tasks::FTask& Existing) { return Existing.IsCompleted(); }, EAllowShrinking::No);
+	WorkerTasks.Add(MoveTemp(Task));
+}
+
+void FSlateAgentBridgeMcpToolDispatcher::EnqueueGameThreadWork(TUniqueFunction<void()>&& Work)
+{
+	bool bScheduleTask = false;
+	{
+		FScopeLock Guard(&QueueMutex);
+		GameThreadWork.Add(MoveTemp(Work));
+		bScheduleTask = !bGameThreadTaskScheduled;
+		bGameThreadTaskScheduled = true;
+	}
+
+	// Work queued while a task is already pending rides along with it.
+	if (bScheduleTask)
+	{
+		AsyncTask(ENamedThreads::GameThread, [WeakSelf = TWeakPtr<FSlateAgentBridgeMcpToolDispatcher>(AsShared())]()
+		{
+			if (TSharedPtr<FSlateAgentBridgeMcpToolDispatcher> Self = WeakSelf.Pin())
+			{
+				Self->RunGameThreadWork();
+			}
+		});
+	}
+}
+
+void FSlateAgentBridgeMcpToolDispatcher::RunGameThreadWork()
+{
+	TArray<TUniqueFunction<void()>> Work;
+	{
+		FScopeLock Guard(&QueueMutex);
+		Work = MoveTemp(GameThreadWork);
+		GameThreadWork.Reset();
+		bGameThreadTaskScheduled = false;
+	}
+
+	for (TUniqueFunction<void()>& Item : Work)
+	{
+		Item();
+	}
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "Mcp/SlateAgentBridgeMcpToolRegistry.h"
+#include "Tasks/Pipe.h"
+#include "Tasks/Task.h"
+
+/**
+ * Runs tools/call invocations outside the session lock according to their tool's policies.
+ * AnyThread tools run on the task graph, Exclusive ones through a shared pipe. Game-thread tools,
+ * and the completions of worker calls, are queued and drained by a single game-thread task, so
+ * everything that arrives within a frame is marshalled once.
+ */
+class FSlateAgentBridgeMcpToolDispatcher : public TSharedFromThis<FSlateAgentBridgeMcpToolDispatcher>
+{
+public:
+	using FOnToolCompleted = TUniqueFunction<void(FSlateAgentBridgeMcpToolResult&&)>;
+
+	FSlateAgentBridgeMcpToolDispatcher();
+
+	/** Runs the call; OnCompleted is always invoked on the game thread. */
+	void Dispatch(FSlateAgentBridgeMcpToolInvocation&& Invocation, FOnToolCompleted&& OnCompleted);
+
+	/**
+	 * Runs Work on the task graph and then OnCompleted in the batched game-thread task, e.g. to
+	 * compress a reply before it is handed back to the HTTP server. Flush waits for it like any call.
+	 */
+	void DispatchWork(TUniqueFunction<void()>&& Work, TUniqueFunction<void()>&& OnCompleted);
+
+	/**
+	 * Waits for calls on worker threads, then runs all queued game-thread work, repeating until work
+	 * queued meanwhile is drained too. Game thread only.
+	 */
+	void Flush();
+
+private:
+	void LaunchWorkerTask(TUniqueFunction<void()>&& Work, bool bExclusive);
+	void EnqueueGameThreadWork(TUniqueFunction<void()>&& Work);
+	void RunGameThreadWork();
+
+	UE::Tasks::FPipe ExclusivePipe;
+
+	FCriticalSection QueueMutex;
+	TArray<TUniqueFunction<void()>> GameThreadWork;
+	TArray<UE::Tasks::FTask> WorkerTasks;
+	bool bGameThreadTaskScheduled;
+};
@@ -0,0 +1,138 @@
+#include "Mcp/SlateAgentBridgeMcpToolRegistry.h"
+
+#include "Mcp/SlateAgentBridgeUtf8JsonWriter.h"
+#include "SlateAgentBridgeLog.h"
+
+#include "Dom/JsonObject.h"
+#include "Misc/Crc.h"
+#include "Misc/ScopeRWLock.h"
+
+namespace
+{
+	FString MakeToolsListETag(const TArray<uint8>& Encoded)
+	{
+		return FString::Printf(TEXT("\"%08x-%x\""), FCrc::MemCrc32(Encoded.GetData(), Encoded.Num()), Encoded.Num());
+	}
+}
+
+FSlateAgentBridgeMcpToolRegistry::FSlateAgentBridgeMcpToolRegistry()
+	: EncodedToolsList(MakeShared<TArray<uint8>>())
+{
+	RebuildEncodedList();
+}
+
+bool FSlateAgentBridgeMcpToolRegistry::RegisterTool(FSlateAgentBridgeMcpToolDefinition Definition)
+{
+	FString Name;
+	if (!Definition.Descriptor.IsValid() || !Definition.Descriptor->TryGetStringField(TEXT("name"), Name) || Name.IsEmpty())
+	{
+		UE_LOG(LogSlateAgentBridge, Warning, TEXT("Ignoring MCP tool descriptor without a name."));
+		return false;
+	}
+
+	if (!Definition.Descriptor->HasTypedField<EJson::Object>(TEXT("inputSchema")) || !Definition.Handler)
+	{
+		UE_LOG(LogSlateAgentBridge, Warning, TEXT("Ignoring MCP tool %s: it needs an inputSchema and a handler."), *Name);
+		return false;
+	}
+
+	TArray<uint8> EncodedDescriptor = FSlateAgentBridgeUtf8JsonWriter::Encode(*Definition.Descriptor);
+
+	TSharedRef<FSlateAgentBridgeMcpRegisteredTool> Entry = MakeShared<FSlateAgentBridgeMcpRegisteredTool>();
+	Entry->Name = Name;
+	Entry->ThreadAffinity = Definition.ThreadAffinity;
+	Entry->Concurrency = Definition.Concurrency;
+	Entry->Handler = MoveTemp(Definition.Handler);
+
+	{
+		FWriteScopeLock WriteGuard(Lock);
+		FTool* Existing = Tools.FindByPredicate([&Name](const FTool& Tool) { return Tool.Entry->Name == Name; });
+		if (Existing)
+		{
+			// Calls already dispatched keep the entry they resolved; new calls get the replacement.
+			Existing->Entry = Entry;
+			if (Existing->EncodedDescriptor == EncodedDescriptor)
+			{
+				return true;
+			}
+			Existing->EncodedDescriptor = MoveTemp(EncodedDescriptor);
+		}
+		else
+		{
+			Tools.Add({ MoveTemp(EncodedDescriptor), Entry });
+		}
+		RebuildEncodedList();
+	}
+
+	ToolsChangedDelegate.Broadcast();
+	return true;
+}
+
+bool FSlateAgentBridgeMcpToolRegistry::UnregisterTool(const FString& Name)
+{
+	{
+		FWriteScopeLock WriteGuard(Lock);
+		if (Tools.RemoveAll([&Name](const FTool& Tool) { return Tool.Entry->Name == Name; }) == 0)
+		{
+			return false;
+		}
+		RebuildEncodedList();
+	}
+
+	ToolsChangedDelegate.Broadcast();
+	return true;
+}
+
+bool FSlateAgentBridgeMcpToolRegistry::HasTool(const FString& Name) const
+{
+	return FindTool(Name).IsValid();
+}
+
+TSharedPtr<const FSlateAgentBridgeMcpRegisteredTool> FSlateAgentBridgeMcpToolRegistry::FindTool(const FString& Name) const
+{
+	FReadScopeLock ReadGuard(Lock);
+	const FTool* Tool = Tools.FindByPredicate([&Name](const FTool& Candidate) { return Candidate.Entry->Name == Name; });
+	return Tool ? Tool->Entry : nullptr;
+}
+
+TSharedRef<const TArray<uint8>> FSlateAgentBridgeMcpToolRegistry::GetEncodedToolsList(FString* OutETag) const
+{
+	FReadScopeLock ReadGuard(Lock);
+	if (OutETag)
+	{
+		*OutETag = ETag;
+	}
+	return EncodedToolsList;
+}
+
+FString FSlateAgentBridgeMcpToolRegistry::GetETag() const
+{
+	FReadScopeLock ReadGuard(Lock);
+	return ETag;
+}
+
+void FSlateAgentBridgeMcpToolRegistry::RebuildEncodedList()
+{
+	int32 Length = 12 + Tools.Num();
+	for (const FTool& Tool : Tools)
+	{
+		Length += Tool.EncodedDescriptor.Num();
+	}
+
+	TArray<uint8> Encoded;
+	Encoded.Reserve(Length);
+	FSlateAgentBridgeUtf8JsonWriter Writer(Encoded);
+	Writer.WriteRaw("{\"tools\":[");
+	for (int32 Index = 0; Index < Tools.Num(); ++Index)
+	{
+		if (Index > 0)
+		{
+			Writer.WriteRaw(",");
+		}
+		Writer.WriteRawUtf8(Tools[Index].EncodedDescriptor);
+	}
+	Writer.WriteRaw("]}");
+
+	ETag = MakeToolsListETag(Encoded);
+	EncodedToolsList = MakeShared<TArray<uint8>>(MoveTemp(Encoded));
+}
@@ -0,0 +1,138 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "Misc/Guid.h"
+
+class FJsonObject;
+class FJsonValue;
+
+/** A liveCoding.compile call whose response is held until the compile it started is finalized. */
+struct FSlateAgentBridgeMcpCompileWait
+{
+	TSharedPtr<FJsonValue> IdValue;
+	uint64 TicketId = 0;
+
+	/** Completed-compile count at which the wait is satisfied. */
+	uint64 CompileGeneration = 0;
+	double TimeoutSeconds = 0.0;
+};
+
+/** Where a tool's handler may run. */
+enum class ESlateAgentBridgeMcpToolThread : uint8
+{
+	/** Only reads thread-safe state; runs on a task graph worker. */
+	AnyThread,
+
+	/** Touches engine or editor state; runs in the per-frame game-thread batch. */
+	GameThread
+};
+
+/** Whether calls of a tool may overlap. */
+enum class ESlateAgentBridgeMcpToolConcurrency : uint8
+{
+	/** Calls may run alongside any other call, including calls of the same tool. */
+	Concurrent,
+
+	/** Calls run one at a time, in arrival order, with respect to every other Exclusive call. */
+	Exclusive
+};
+
+/** One tools/call, as handed to a tool's handler. */
+struct FSlateAgentBridgeMcpToolCall
+{
+	TSharedPtr<FJsonValue> IdValue;
+
+	/** The call's "arguments" object; null when the client sent none. */
+	TSharedPtr<FJsonObject> Arguments;
+
+	/** Session that issued the call, for logging. */
+	FGuid ClientId;
+
+	/** False inside batches, where the response cannot be held for a compile. */
+	bool bCanHoldResponse = false;
+};
+
+struct FSlateAgentBridgeMcpToolResult
+{
+	FString Message;
+	TSharedPtr<FJsonObject> Structured;
+	bool bIsError = false;
+
+	/** Set instead of a result when the response is held until a compile finishes. */
+	TOptional<FSlateAgentBridgeMcpCompileWait> CompileWait;
+};
+
+using FSlateAgentBridgeMcpToolHandler = TFunction<FSlateAgentBridgeMcpToolResult(const FSlateAgentBridgeMcpToolCall&)>;
+
+/** Everything needed to expose a tool over MCP. */
+struct FSlateAgentBridgeMcpToolDefinition
+{
+	/** The tools/list entry: name, description and inputSchema, plus optional outputSchema and annotations. */
+	TSharedPtr<FJsonObject> Descriptor;
+
+	ESlateAgentBridgeMcpToolThread ThreadAffinity = ESlateAgentBridgeMcpToolThread::GameThread;
+	ESlateAgentBridgeMcpToolConcurrency Concurrency = ESlateAgentBridgeMcpToolConcurrency::Exclusive;
+	FSlateAgentBridgeMcpToolHandler Handler;
+};
+
+/** A registered tool as handed out for dispatch; never modified after registration. */
+struct FSlateAgentBridgeMcpRegisteredTool
+{
+	FString Name;
+	ESlateAgentBridgeMcpToolThread ThreadAffinity = ESlateAgentBridgeMcpToolThread::GameThread;
+	ESlateAgentBridgeMcpToolConcurrency Concurrency = ESlateAgentBridgeMcpToolConcurrency::Exclusive;
+	FSlateAgentBridgeMcpToolHandler Handler;
+};
+
+/** A tools/call taken out of the session, to be run according to its tool's policies. */
+struct FSlateAgentBridgeMcpToolInvocation
+{
+	TSharedPtr<const FSlateAgentBridgeMcpRegisteredTool> Tool;
+	FSlateAgentBridgeMcpToolCall Call;
+};
+
+/**
+ * The MCP tools exposed by the server. Each descriptor is serialized to UTF-8 once when it is
+ * registered, and the tools/list result is kept pre-encoded together with an ETag, so listing tools
+ * costs a shared-pointer copy and a single append into the response body.
+ */
+class FSlateAgentBridgeMcpToolRegistry
+{
+public:
+	FSlateAgentBridgeMcpToolRegistry();
+
+	/**
+	 * Adds a tool or replaces the one with the same name. The descriptor must carry a name and an
+	 * inputSchema object, and the handler must be bound.
+	 */
+	bool RegisterTool(FSlateAgentBridgeMcpToolDefinition Definition);
+	bool UnregisterTool(const FString& Name);
+	bool HasTool(const FString& Name) const;
+	TSharedPtr<const FSlateAgentBridgeMcpRegisteredTool> FindTool(const FString& Name) const;
+
+	/** UTF-8 encoded tools/list result object and its quoted ETag, taken as one consistent snapshot. */
+	TSharedRef<const TArray<uint8>> GetEncodedToolsList(FString* OutETag = nullptr) const;
+	FString GetETag() const;
+
+	/** Raised after the set of tools or one of their descriptors changed; not raised for no-op registrations. */
+	FSimpleMulticastDelegate& OnToolsChanged() { return ToolsChangedDelegate; }
+
+private:
+	struct FTool
+	{
+		TArray<uint8> EncodedDescriptor;
+		TSharedPtr<const FSlateAgentBridgeMcpRegisteredTool> Entry;
+	};
+
+	void RebuildEncodedList();
+
+	mutable FRWLock Lock;
+
+	/** Registration order, which is also the tools/list order. */
+	TArray<FTool> Tools;
+	TSharedRef<const TArray<uint8>> EncodedToolsList;
+	FString ETag;
+
+	FSimpleMulticastDelegate ToolsChangedDelegate;
+};
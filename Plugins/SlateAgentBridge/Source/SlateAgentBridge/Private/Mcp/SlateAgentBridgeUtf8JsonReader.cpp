@@ -0,0 +1,552 @@
+#include "Mcp/SlateAgentBridgeUtf8JsonReader.h"
+
+#include "SlateAgentBridgeLog.h"
+
+#include "Containers/StringConv.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+namespace
+{
+	/** Guards the recursive descent against hostile, deeply nested payloads. */
+	constexpr int32 MaxNestingDepth = 64;
+
+	FString Utf8SliceToString(const uint8* Data, int32 Length)
+	{
+		if (Length <= 0)
+		{
+			return FString();
+		}
+
+		FUTF8ToTCHAR Converter(reinterpret_cast<const ANSICHAR*>(Data), Length);
+		return FString(Converter.Length(), Converter.Get());
+	}
+
+	void AppendCodePointUtf8(TArray<UTF8CHAR>& Out, uint32 CodePoint)
+	{
+		if (CodePoint < 0x80)
+		{
+			Out.Add(static_cast<UTF8CHAR>(CodePoint));
+		}
+		else if (CodePoint < 0x800)
+		{
+			Out.Add(static_cast<UTF8CHAR>(0xC0 | (CodePoint >> 6)));
+			Out.Add(static_cast<UTF8CHAR>(0x80 | (CodePoint & 0x3F)));
+		}
+		else if (CodePoint < 0x10000)
+		{
+			Out.Add(static_cast<UTF8CHAR>(0xE0 | (CodePoint >> 12)));
+			Out.Add(static_cast<UTF8CHAR>(0x80 | ((CodePoint >> 6) & 0x3F)));
+			Out.Add(static_cast<UTF8CHAR>(0x80 | (CodePoint & 0x3F)));
+		}
+		else
+		{
+			Out.Add(static_cast<UTF8CHAR>(0xF0 | (CodePoint >> 18)));
+			Out.Add(static_cast<UTF8CHAR>(0x80 | ((CodePoint >> 12) & 0x3F)));
+			Out.Add(static_cast<UTF8CHAR>(0x80 | ((CodePoint >> 6) & 0x3F)));
+			Out.Add(static_cast<UTF8CHAR>(0x80 | (CodePoint & 0x3F)));
+		}
+	}
+}
+
+FSlateAgentBridgeUtf8JsonReader::FSlateAgentBridgeUtf8JsonReader(TConstArrayView<uint8> Utf8)
+	: Begin(Utf8.GetData())
+	, Cursor(Utf8.GetData())
+	, End(Utf8.GetData() + Utf8.Num())
+{
+	// Tolerate a UTF-8 byte order mark; some clients prepend one.
+	if (End - Cursor >= 3 && Cursor[0] == 0xEF && Cursor[1] == 0xBB && Cursor[2] == 0xBF)
+	{
+		Cursor += 3;
+	}
+}
+
+TSharedPtr<FJsonValue> FSlateAgentBridgeUtf8JsonReader::Parse(TConstArrayView<uint8> Utf8, FString* OutError)
+{
+	FSlateAgentBridgeUtf8JsonReader Reader(Utf8);
+
+	TSharedPtr<FJsonValue> Value = Reader.ReadValue(0);
+	if (Value.IsValid())
+	{
+		Reader.SkipWhitespace();
+		if (Reader.Cursor != Reader.End)
+		{
+			Reader.Fail(TEXT("Unexpected data after the top-level value"));
+			Value.Reset();
+		}
+	}
+
+	if (!Value.IsValid() && OutError)
+	{
+		*OutError = MoveTemp(Reader.Error);
+	}
+	return Value;
+}
+
+TSharedPtr<FJsonObject> FSlateAgentBridgeUtf8JsonReader::ParseObject(TConstArrayView<uint8> Utf8, FString* OutError)
+{
+	TSharedPtr<FJsonValue> Value = Parse(Utf8, OutError);
+	if (!Value.IsValid())
+	{
+		return nullptr;
+	}
+
+	if (Value->Type != EJson::Object)
+	{
+		if (OutError)
+		{
+			*OutError = TEXT("Top-level JSON value is not an object");
+		}
+		return nullptr;
+	}
+
+	return Value->AsObject();
+}
+
+TSharedPtr<FJsonValue> FSlateAgentBridgeUtf8JsonReader::ReadValue(int32 Depth)
+{
+	SkipWhitespace();
+	if (Cursor == End)
+	{
+		Fail(TEXT("Unexpected end of input"));
+		return nullptr;
+	}
+
+	switch (*Cursor)
+	{
+	case '{':
+	{
+		TSharedPtr<FJsonObject> Object = ReadObject(Depth + 1);
+		return Object.IsValid() ? MakeShared<FJsonValueObject>(Object) : nullptr;
+	}
+	case '[':
+	{
+		TArray<TSharedPtr<FJsonValue>> Values;
+		return ReadArray(Depth + 1, Values) ? MakeShared<FJsonValueArray>(MoveTemp(Values)) : nullptr;
+	}
+	case '"':
+	{
+		FString String;
+		return ReadString(String) ? MakeShared<FJsonValueString>(MoveTemp(String)) : nullptr;
+	}
+	case 't':
+		return ReadLiteral("true") ? MakeShared<FJsonValueBoolean>(true) : nullptr;
+	case 'f':
+		return ReadLiteral("false") ? MakeShared<FJsonValueBoolean>(false) : nullptr;
+	case 'n':
+		return ReadLiteral("null") ? MakeShared<FJsonValueNull>() : nullptr;
+	default:
+	{
+		double Number = 0.0;
+		return ReadNumber(Number) ? MakeShared<FJsonValueNumber>(Number) : nullptr;
+	}
+	}
+}
+
+TSharedPtr<FJsonObject> FSlateAgentBridgeUtf8JsonReader::ReadObject(int32 Depth)
+{
+	if (Depth > MaxNestingDepth)
+	{
+		Fail(TEXT("Nesting too deep"));
+		return nullptr;
+	}
+
+	++Cursor; // '{'
+	TSharedPtr<FJsonObject> Object = MakeShared<FJsonObject>();
+
+	SkipWhitespace();
+	if (Cursor != End && *Cursor == '}')
+	{
+		++Cursor;
+		return Object;
+	}
+
+	while (true)
+	{
+		SkipWhitespace();
+		if (Cursor == End || *Cursor != '"')
+		{
+			Fail(TEXT("Expected an object key"));
+			return nullptr;
+		}
+
+		FString Key;
+		if (!ReadString(Key))
+		{
+			return nullptr;
+		}
+
+		SkipWhitespace();
+		if (Cursor == End || *Cursor != ':')
+		{
+			Fail(TEXT("Expected ':' after object key"));
+			return nullptr;
+		}
+		++Cursor;
+
+		TSharedPtr<FJsonValue> Value = ReadValue(Depth);
+		if (!Value.IsValid())
+		{
+			return nullptr;
+		}
+		Object->Values.Add(MoveTemp(Key), MoveTemp(Value));
+
+		SkipWhitespace();
+		if (Cursor == End)
+		{
+			Fail(TEXT("Unterminated object"));
+			return nullptr;
+		}
+		if (*Cursor == ',')
+		{
+			++Cursor;
+			continue;
+		}
+		if (*Cursor == '}')
+		{
+			++Cursor;
+			return Object;
+		}
+
+		Fail(TEXT("Expected ',' or '}' in object"));
+		return nullptr;
+	}
+}
+
+bool FSlateAgentBridgeUtf8JsonReader::ReadArray(int32 Depth, TArray<TSharedPtr<FJsonValue>>& OutValues)
+{
+	if (Depth > MaxNestingDepth)
+	{
+		return Fail(TEXT("Nesting too deep"));
+	}
+
+	++Cursor; // '['
+
+	SkipWhitespace();
+	if (Cursor != End && *Cursor == ']')
+	{
+		++Cursor;
+		return true;
+	}
+
+	while (true)
+	{
+		TSharedPtr<FJsonValue> Value = ReadValue(Depth);
+		if (!Value.IsValid())
+		{
+			return false;
+		}
+		OutValues.Add(MoveTemp(Value));
+
+		SkipWhitespace();
+		if (Cursor == End)
+		{
+			return Fail(TEXT("Unterminated array"));
+		}
+		if (*Cursor == ',')
+		{
+			++Cursor;
+			continue;
+		}
+		if (*Cursor == ']')
+		{
+			++Cursor;
+			return true;
+		}
+
+		return Fail(TEXT("Expected ',' or ']' in array"));
+	}
+}
+
+bool FSlateAgentBridgeUtf8JsonReader::ReadString(FString& OutString)
+{
+	++Cursor; // opening quote
+
+	// Fast path: no escapes, convert the raw slice in one go.
+	const uint8* SliceStart = Cursor;
+	while (Cursor != End && *Cursor != '"' && *Cursor != '\\')
+	{
+		if (*Cursor < 0x20)
+		{
+			return Fail(TEXT("Control character in string"));
+		}
+		++Cursor;
+	}
+
+	if (Cursor == End)
+	{
+		return Fail(TEXT("Unterminated string"));
+	}
+
+	if (*Cursor == '"')
+	{
+		OutString = Utf8SliceToString(SliceStart, static_cast<int32>(Cursor - SliceStart));
+		++Cursor;
+		return true;
+	}
+
+	// Slow path: unescape into a UTF-8 scratch buffer and convert once at the end.
+	EscapeScratch.Reset();
+	EscapeScratch.Append(reinterpret_cast<const UTF8CHAR*>(SliceStart), static_cast<int32>(Cursor - SliceStart));
+
+	while (Cursor != End)
+	{
+		const uint8 Char = *Cursor++;
+		if (Char == '"')
+		{
+			OutString = Utf8SliceToString(reinterpret_cast<const uint8*>(EscapeScratch.GetData()), EscapeScratch.Num());
+			return true;
+		}
+
+		if (Char < 0x20)
+		{
+			return Fail(TEXT("Control character in string"));
+		}
+
+		if (Char != '\\')
+		{
+			EscapeScratch.Add(static_cast<UTF8CHAR>(Char));
+			continue;
+		}
+
+		if (Cursor == End)
+		{
+			break;
+		}
+
+		const uint8 Escape = *Cursor++;
+		switch (Escape)
+		{
+		case '"':  EscapeScratch.Add(static_cast<UTF8CHAR>('"')); break;
+		case '\\': EscapeScratch.Add(static_cast<UTF8CHAR>('\\')); break;
+		case '/':  EscapeScratch.Add(static_cast<UTF8CHAR>('/')); break;
+		case 'b':  EscapeScratch.Add(static_cast<UTF8CHAR>('\b')); break;
+		case 'f':  EscapeScratch.Add(static_cast<UTF8CHAR>('\f')); break;
+		case 'n':  EscapeScratch.Add(static_cast<UTF8CHAR>('\n')); break;
+		case 'r':  EscapeScratch.Add(static_cast<UTF8CHAR>('\r')); break;
+		case 't':  EscapeScratch.Add(static_cast<UTF8CHAR>('\t')); break;
+		case 'u':
+		{
+			uint32 CodePoint = 0;
+			if (!ReadHexQuad(CodePoint))
+			{
+				return false;
+			}
+
+			if (CodePoint >= 0xD800 && CodePoint <= 0xDBFF)
+			{
+				uint32 LowSurrogate = 0;
+				if (End - Cursor < 6 || Cursor[0] != '\\' || Cursor[1] != 'u')
+				{
+					return Fail(TEXT("Unpaired surrogate in string"));
+				}
+				Cursor += 2;
+				if (!ReadHexQuad(LowSurrogate) || LowSurrogate < 0xDC00 || LowSurrogate > 0xDFFF)
+				{
+					return Fail(TEXT("Invalid surrogate pair in string"));
+				}
+				CodePoint = 0x10000 + ((CodePoint - 0xD800) << 10) + (LowSurrogate - 0xDC00);
+			}
+			else if (CodePoint >= 0xDC00 && CodePoint <= 0xDFFF)
+			{
+				return Fail(TEXT("Unpaired surrogate in string"));
+			}
+
+			AppendCodePointUtf8(EscapeScratch, CodePoint);
+			break;
+		}
+		default:
+			return Fail(TEXT("Invalid escape sequence"));
+		}
+	}
+
+	return Fail(TEXT("Unterminated string"));
+}
+
+bool FSlateAgentBridgeUtf8JsonReader::ReadHexQuad(uint32& OutValue)
+{
+	if (End - Cursor < 4)
+	{
+		return Fail(TEXT("Truncated \\u escape"));
+	}
+
+	OutValue = 0;
+	for (int32 Index = 0; Index < 4; ++Index)
+	{
+		const uint8 Char = *Cursor++;
+		uint32 Digit = 0;
+		if (Char >= '0' && Char <= '9')
+		{
+			Digit = Char - '0';
+		}
+		else if (Char >= 'a' && Char <= 'f')
+		{
+			Digit = 10 + Char - 'a';
+		}
+		else if (Char >= 'A' && Char <= 'F')
+		{
+			Digit = 10 + Char - 'A';
+		}
+		else
+		{
+			return Fail(TEXT("Invalid hex digit in \\u escape"));
+		}
+		OutValue = (OutValue << 4) | Digit;
+	}
+	return true;
+}
+
+bool FSlateAgentBridgeUtf8JsonReader::ReadNumber(double& OutNumber)
+{
+	const uint8* Start = Cursor;
+
+	auto ConsumeDigits = [this]()
+	{
+		const uint8* DigitsStart = Cursor;
+		while (Cursor != End && *Cursor >= '0' && *Cursor <= '9')
+		{
+			++Cursor;
+		}
+		return Cursor != DigitsStart;
+	};
+
+	if (Cursor != End && *Cursor == '-')
+	{
+		++Cursor;
+	}
+	if (!ConsumeDigits())
+	{
+		return Fail(TEXT("Invalid value"));
+	}
+	if (Cursor != End && *Cursor == '.')
+	{
+		++Cursor;
+		if (!ConsumeDigits())
+		{
+			return Fail(TEXT("Invalid number fraction"));
+		}
+	}
+	if (Cursor != End && (*Cursor == 'e' || *Cursor == 'E'))
+	{
+		++Cursor;
+		if (Cursor != End && (*Cursor == '+' || *Cursor == '-'))
+		{
+			++Cursor;
+		}
+		if (!ConsumeDigits())
+		{
+			return Fail(TEXT("Invalid number exponent"));
+		}
+	}
+
+	const int32 Length = static_cast<int32>(Cursor - Start);
+	ANSICHAR Buffer[64];
+	if (Length >= UE_ARRAY_COUNT(Buffer))
+	{
+		return Fail(TEXT("Number literal too long"));
+	}
+
+	FMemory::Memcpy(Buffer, Start, Length);
+	Buffer[Length] = '\0';
+	OutNumber = FCStringAnsi::Atod(Buffer);
+	return true;
+}
+
+bool FSlateAgentBridgeUtf8JsonReader::ReadLiteral(const ANSICHAR* Literal)
+{
+	const int32 Length = FCStringAnsi::Strlen(Literal);
+	if (End - Cursor < Length || FMemory::Memcmp(Cursor, Literal, Length) != 0)
+	{
+		return Fail(TEXT("Invalid literal"));
+	}
+	Cursor += Length;
+	return true;
+}
+
+void FSlateAgentBridgeUtf8JsonReader::SkipWhitespace()
+{
+	while (Cursor != End && (*Cursor == ' ' || *Cursor == '\t' || *Cursor == '\n' || *Cursor == '\r'))
+	{
+		++Cursor;
+	}
+}
+
+bool FSlateAgentBridgeUtf8JsonReader::Fail(const TCHAR* Reason)
+{
+	if (Error.IsEmpty())
+	{
+		Error = FString::Printf(TEXT("%s at byte %d"), Reason, static_cast<int32>(Cursor - Begin));
+	}
+	return false;
+}
+
+namespace
+{
+	/**
+	 * Compares the previous request path (widen the body to TCHAR, parse once in the server to sniff
+	 * the method and again in the session) against a single UTF-8 parse of the same body.
+	 * Usage: SlateAgentBridge.Mcp.BenchmarkParse [Iterations] [LogLines]
+	 */
+	FAutoConsoleCommand BenchmarkParseCommand(
+		TEXT("SlateAgentBridge.Mcp.BenchmarkParse"),
+		TEXT("Measures per-request JSON-RPC parse cost of the legacy double parse against the single UTF-8 parse."),
+		FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+		{
+			const int32 Iterations = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 10000;
+			const int32 PayloadEntries = Args.Num() > 1 ? FMath::Max(0, FCString::Atoi(*Args[1])) : 32;
+
+			FString Payload = TEXT("{\"jsonrpc\":\"2.0\",\"id\":42,\"method\":\"tools/call\",\"params\":{\"name\":\"liveCoding.status\",\"arguments\":{\"notes\":[");
+			for (int32 Index = 0; Index < PayloadEntries; ++Index)
+			{
+				Payload += FString::Printf(TEXT("%s{\"line\":%d,\"text\":\"Compilation d\\u00e9marr\u00e9e \\\"Module%d\\\" \u2713\"}"), Index > 0 ? TEXT(",") : TEXT(""), Index, Index);
+			}
+			Payload += TEXT("]}}}");
+
+			const FTCHARToUTF8 Utf8Payload(*Payload);
+			const TConstArrayView<uint8> Body(reinterpret_cast<const uint8*>(Utf8Payload.Get()), Utf8Payload.Length());
+
+			int32 Checksum = 0;
+
+			const double LegacyStart = FPlatformTime::Seconds();
+			for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+			{
+				FUTF8ToTCHAR Converter(reinterpret_cast<const ANSICHAR*>(Body.GetData()), Body.Num());
+				const FString BodyString(Converter.Length(), Converter.Get());
+
+				for (int32 Pass = 0; Pass < 2; ++Pass)
+				{
+					TSharedPtr<FJsonObject> Object;
+					TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(BodyString);
+					if (FJsonSerializer::Deserialize(Reader, Object) && Object.IsValid())
+					{
+						Checksum += Object->Values.Num();
+					}
+				}
+			}
+			const double LegacySeconds = FPlatformTime::Seconds() - LegacyStart;
+
+			const double Utf8Start = FPlatformTime::Seconds();
+			for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+			{
+				if (TSharedPtr<FJsonObject> Object = FSlateAgentBridgeUtf8JsonReader::ParseObject(Body))
+				{
+					Checksum += Object->Values.Num();
+				}
+			}
+			const double Utf8Seconds = FPlatformTime::Seconds() - Utf8Start;
+
+			const double LegacyMicros = LegacySeconds * 1.0e6 / Iterations;
+			const double Utf8Micros = Utf8Seconds * 1.0e6 / Iterations;
+			UE_LOG(LogSlateAgentBridge, Display, TEXT("MCP parse benchmark: %d iterations, %d byte body. Legacy double parse %.2f us/request, single UTF-8 parse %.2f us/request (%.2fx). [checksum %d]"),
+				Iterations,
+				Body.Num(),
+				LegacyMicros,
+				Utf8Micros,
+				Utf8Micros > 0.0 ? LegacyMicros / Utf8Micros : 0.0,
+				Checksum);
+		}));
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FJsonObject;
+class FJsonValue;
+
+/**
+ * Parses a JSON document directly from a UTF-8 buffer (e.g. an HTTP request body) into the
+ * engine JSON DOM. The payload is never widened to TCHAR as a whole; only string values are
+ * converted, and strings without escapes are converted straight from the source bytes.
+ */
+class FSlateAgentBridgeUtf8JsonReader
+{
+public:
+	/** Parses a complete JSON value. Returns null and fills OutError on malformed input or trailing data. */
+	static TSharedPtr<FJsonValue> Parse(TConstArrayView<uint8> Utf8, FString* OutError = nullptr);
+
+	/** Convenience wrapper for payloads whose top-level value must be an object. */
+	static TSharedPtr<FJsonObject> ParseObject(TConstArrayView<uint8> Utf8, FString* OutError = nullptr);
+
+private:
+	explicit FSlateAgentBridgeUtf8JsonReader(TConstArrayView<uint8> Utf8);
+
+	TSharedPtr<FJsonValue> ReadValue(int32 Depth);
+	TSharedPtr<FJsonObject> ReadObject(int32 Depth);
+	bool ReadArray(int32 Depth, TArray<TSharedPtr<FJsonValue>>& OutValues);
+	bool ReadString(FString& OutString);
+	bool ReadNumber(double& OutNumber);
+	bool ReadLiteral(const ANSICHAR* Literal);
+	bool ReadHexQuad(uint32& OutValue);
+	void SkipWhitespace();
+	bool Fail(const TCHAR* Reason);
+
+	const uint8* Begin;
+	const uint8* Cursor;
+	const uint8* End;
+	FString Error;
+	TArray<UTF8CHAR> EscapeScratch;
+};
@@ -0,0 +1,238 @@
+#include "Mcp/SlateAgentBridgeUtf8JsonWriter.h"
+
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+
+namespace
+{
+	constexpr ANSICHAR JsonEscapeHexDigits[] = "0123456789abcdef";
+
+	/** Largest magnitude below which every integral double is exact and printed without an exponent. */
+	constexpr double MaxExactIntegerDouble = 9007199254740992.0;
+
+	bool IsPlainJsonChar(uint32 Char)
+	{
+		return Char >= 0x20 && Char < 0x80 && Char != '"' && Char != '\\';
+	}
+}
+
+FSlateAgentBridgeUtf8JsonWriter::FSlateAgentBridgeUtf8JsonWriter(TArray<uint8>& InOutput)
+	: Output(InOutput)
+{
+}
+
+void FSlateAgentBridgeUtf8JsonWriter::WriteValue(const TSharedPtr<FJsonValue>& Value)
+{
+	if (!Value.IsValid())
+	{
+		WriteRaw("null");
+		return;
+	}
+
+	switch (Value->Type)
+	{
+	case EJson::String:
+		WriteString(Value->AsString());
+		break;
+	case EJson::Number:
+		WriteNumber(Value->AsNumber());
+		break;
+	case EJson::Boolean:
+		WriteRaw(Value->AsBool() ? "true" : "false");
+		break;
+	case EJson::Array:
+		WriteArray(Value->AsArray());
+		break;
+	case EJson::Object:
+		if (const TSharedPtr<FJsonObject>& Object = Value->AsObject())
+		{
+			WriteObject(*Object);
+		}
+		else
+		{
+			WriteRaw("null");
+		}
+		break;
+	case EJson::None:
+	case EJson::Null:
+	default:
+		WriteRaw("null");
+		break;
+	}
+}
+
+void FSlateAgentBridgeUtf8JsonWriter::WriteObject(const FJsonObject& Object)
+{
+	Output.Add('{');
+	bool bFirstField = true;
+	for (const TPair<FString, TSharedPtr<FJsonValue>>& Field : Object.Values)
+	{
+		if (!bFirstField)
+		{
+			Output.Add(',');
+		}
+		bFirstField = false;
+
+		WriteString(Field.Key);
+		Output.Add(':');
+		WriteValue(Field.Value);
+	}
+	Output.Add('}');
+}
+
+void FSlateAgentBridgeUtf8JsonWriter::WriteArray(const TArray<TSharedPtr<FJsonValue>>& Values)
+{
+	Output.Add('[');
+	for (int32 Index = 0; Index < Values.Num(); ++Index)
+	{
+		if (Index > 0)
+		{
+			Output.Add(',');
+		}
+		WriteValue(Values[Index]);
+	}
+	Output.Add(']');
+}
+
+void FSlateAgentBridgeUtf8JsonWriter::WriteString(FStringView Value)
+{
+	// Sized for ASCII text; multi-byte characters and escapes grow the buffer as needed.
+	Output.Reserve(Output.Num() + Value.Len() + 2);
+	Output.Add('"');
+
+	const TCHAR* Cursor = Value.GetData();
+	const TCHAR* const End = Cursor + Value.Len();
+	while (Cursor < End)
+	{
+		// Copy runs that need neither escaping nor transcoding in one go.
+		const TCHAR* RunStart = Cursor;
+		while (Cursor < End && IsPlainJsonChar(static_cast<uint32>(*Cursor)))
+		{
+			++Cursor;
+		}
+
+		if (Cursor > RunStart)
+		{
+			const int32 RunLength = static_cast<int32>(Cursor - RunStart);
+			uint8* Dest = Output.GetData() + Output.AddUninitialized(RunLength);
+			for (int32 Index = 0; Index < RunLength; ++Index)
+			{
+				Dest[Index] = static_cast<uint8>(RunStart[Index]);
+			}
+		}
+
+		if (Cursor == End)
+		{
+			break;
+		}
+
+		uint32 CodePoint = static_cast<uint32>(*Cursor++);
+		switch (CodePoint)
+		{
+		case '"':  WriteRaw("\\\""); continue;
+		case '\\': WriteRaw("\\\\"); continue;
+		case '\n': WriteRaw("\\n"); continue;
+		case '\r': WriteRaw("\\r"); continue;
+		case '\t': WriteRaw("\\t"); continue;
+		case '\b': WriteRaw("\\b"); continue;
+		case '\f': WriteRaw("\\f"); continue;
+		default: break;
+		}
+
+		if (CodePoint < 0x20)
+		{
+			const ANSICHAR Escape[] = { '\\', 'u', '0', '0', JsonEscapeHexDigits[CodePoint >> 4], JsonEscapeHexDigits[CodePoint & 0xF] };
+			Output.Append(reinterpret_cast<const uint8*>(Escape), UE_ARRAY_COUNT(Escape));
+			continue;
+		}
+
+		// TCHAR is UTF-16 on most platforms; join surrogate pairs and replace unpaired halves.
+		if (CodePoint >= 0xD800 && CodePoint <= 0xDBFF)
+		{
+			const uint32 LowSurrogate = Cursor < End ? static_cast<uint32>(*Cursor) : 0;
+			if (LowSurrogate >= 0xDC00 && LowSurrogate <= 0xDFFF)
+			{
+				CodePoint = 0x10000 + ((CodePoint - 0xD800) << 10) + (LowSurrogate - 0xDC00);
+				++Cursor;
+			}
+			else
+			{
+				CodePoint = 0xFFFD;
+			}
+		}
+		else if ((CodePoint >= 0xDC00 && CodePoint <= 0xDFFF) || CodePoint > 0x10FFFF)
+		{
+			CodePoint = 0xFFFD;
+		}
+
+		AppendCodePoint(CodePoint);
+	}
+
+	Output.Add('"');
+}
+
+void FSlateAgentBridgeUtf8JsonWriter::WriteNumber(double Value)
+{
+	// JSON has no representation for NaN or infinity.
+	if (!FMath::IsFinite(Value))
+	{
+		WriteRaw("null");
+		return;
+	}
+
+	ANSICHAR Buffer[40];
+	int32 Length = 0;
+	if (FMath::Abs(Value) < MaxExactIntegerDouble && Value == FMath::FloorToDouble(Value))
+	{
+		Length = FCStringAnsi::Snprintf(Buffer, UE_ARRAY_COUNT(Buffer), "%lld", static_cast<long long>(Value));
+	}
+	else
+	{
+		Length = FCStringAnsi::Snprintf(Buffer, UE_ARRAY_COUNT(Buffer), "%.17g", Value);
+	}
+	Output.Append(reinterpret_cast<const uint8*>(Buffer), FMath::Clamp(Length, 0, static_cast<int32>(UE_ARRAY_COUNT(Buffer)) - 1));
+}
+
+void FSlateAgentBridgeUtf8JsonWriter::WriteRaw(FAnsiStringView Text)
+{
+	Output.Append(reinterpret_cast<const uint8*>(Text.GetData()), Text.Len());
+}
+
+void FSlateAgentBridgeUtf8JsonWriter::WriteRawUtf8(TConstArrayView<uint8> Utf8)
+{
+	Output.Append(Utf8.GetData(), Utf8.Num());
+}
+
+TArray<uint8> FSlateAgentBridgeUtf8JsonWriter::Encode(const FJsonObject& Object)
+{
+	TArray<uint8> Encoded;
+	FSlateAgentBridgeUtf8JsonWriter Writer(Encoded);
+	Writer.WriteObject(Object);
+	return Encoded;
+}
+
+void FSlateAgentBridgeUtf8JsonWriter::AppendCodePoint(uint32 CodePoint)
+{
+	if (CodePoint < 0x80)
+	{
+		Output.Add(static_cast<uint8>(CodePoint));
+	}
+	else if (CodePoint < 0x800)
+	{
+		Output.Add(static_cast<uint8>(0xC0 | (CodePoint >> 6)));
+		Output.Add(static_cast<uint8>(0x80 | (CodePoint & 0x3F)));
+	}
+	else if (CodePoint < 0x10000)
+	{
+		Output.Add(static_cast<uint8>(0xE0 | (CodePoint >> 12)));
+		Output.Add(static_cast<uint8>(0x80 | ((CodePoint >> 6) & 0x3F)));
+		Output.Add(static_cast<uint8>(0x80 | (CodePoint & 0x3F)));
+	}
+	else
+	{
+		Output.Add(static_cast<uint8>(0xF0 | (CodePoint >> 18)));
+		Output.Add(static_cast<uint8>(0x80 | ((CodePoint >> 12) & 0x3F)));
+		Output.Add(static_cast<uint8>(0x80 | ((CodePoint >> 6) & 0x3F)));
+		Output.Add(static_cast<uint8>(0x80 | (CodePoint & 0x3F)));
+	}
+}
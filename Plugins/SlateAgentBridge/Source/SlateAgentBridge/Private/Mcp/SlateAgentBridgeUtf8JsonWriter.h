@@ -0,0 +1,38 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FJsonObject;
+class FJsonValue;
+
+/**
+ * Serializes the engine JSON DOM as condensed UTF-8 straight into a caller-owned byte buffer,
+ * typically an HTTP response body. Strings are escaped and transcoded in the same pass, so nothing
+ * is staged in a TCHAR FString. Line breaks inside strings are always escaped, which means the
+ * output never spans more than one line.
+ */
+class FSlateAgentBridgeUtf8JsonWriter
+{
+public:
+	explicit FSlateAgentBridgeUtf8JsonWriter(TArray<uint8>& InOutput);
+
+	void WriteValue(const TSharedPtr<FJsonValue>& Value);
+	void WriteObject(const FJsonObject& Object);
+	void WriteArray(const TArray<TSharedPtr<FJsonValue>>& Values);
+	void WriteString(FStringView Value);
+	void WriteNumber(double Value);
+
+	/** Appends ASCII text that is already valid JSON in this position, e.g. punctuation or a literal. */
+	void WriteRaw(FAnsiStringView Text);
+
+	/** Appends a fragment that was encoded earlier, e.g. a cached tools/list result. */
+	void WriteRawUtf8(TConstArrayView<uint8> Utf8);
+
+	/** Condensed UTF-8 encoding of an object, for fragments that are encoded once and reused. */
+	static TArray<uint8> Encode(const FJsonObject& Object);
+
+private:
+	void AppendCodePoint(uint32 CodePoint);
+
+	TArray<uint8>& Output;
+};
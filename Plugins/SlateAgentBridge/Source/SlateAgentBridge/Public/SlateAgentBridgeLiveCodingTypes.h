@@ -11,4 +11,61 @@ struct FSlateAgentBridgeLogEntry
 	FString Category;
 	FString Verbosity;
 	FDateTime Timestamp;
+
+	/** Position in the compile log store; 0 until the entry is committed to it. */
+	uint64 Sequence = 0;
+};
+
+enum class ESlateAgentBridgeCompileTicketState : uint8
+{
+	Unknown,
+	Queued,
+	Running,
+	Finished
+};
+
+/** Handed to every compile request; identifies the compile run that will cover the caller's change. */
+struct FSlateAgentBridgeCompileTicket
+{
+	uint64 TicketId = 0;
+
+	/** Completed-compile count at which the covering run has finished. */
+	uint64 CompileGeneration = 0;
+
+	/** True when the request joined a follow-up compile that other callers had already queued. */
+	bool bCoalesced = false;
+
+	/** False when the request was queued behind the compile currently in flight. */
+	bool bStartedImmediately = false;
 };
+
+struct FSlateAgentBridgeCompileTicketStatus
+{
+	ESlateAgentBridgeCompileTicketState State = ESlateAgentBridgeCompileTicketState::Unknown;
+	uint64 CompileGeneration = 0;
+	FString CompileResult;
+	FString ErrorMessage;
+};
+
+enum class ESlateAgentBridgeCompileEventType : uint8
+{
+	Started,
+	LogLine,
+	Finished
+};
+
+/** Progress notification raised by the Live Coding manager while a compile runs. */
+struct FSlateAgentBridgeCompileEvent
+{
+	ESlateAgentBridgeCompileEventType Type = ESlateAgentBridgeCompileEventType::Started;
+
+	/** Captured line, set for LogLine events. */
+	FSlateAgentBridgeLogEntry LogEntry;
+
+	/** Compile result string and summary, set for Finished events. */
+	FString CompileResult;
+	FString Message;
+};
+
+/** Broadcast on the game thread; LogLine events follow the compile ticker's drain of the capture buffer. */
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnSlateAgentBridgeCompileEvent, const FSlateAgentBridgeCompileEvent&);
@@ -27,7 +27,7 @@ private:
 
 private:
 	TUniquePtr<FSlateAgentBridgeMcpServer> McpServer;
-	TUniquePtr<FSlateAgentBridgeLiveCodingManager> LiveCodingManager;
+	TSharedPtr<FSlateAgentBridgeLiveCodingManager> LiveCodingManager;
 	uint32 McpServerPort = 8133;
 	FString McpBindAddress;
 };
@@ -1,29 +1,85 @@
 #include "UI/Style/LunaraTeomSlateWidgetStyle.h"
 #include "Styling/CoreStyle.h"
+#include "UObject/UObjectGlobals.h"
 
 const FName FLunaraTeomSlateStyle::TypeName(TEXT("FLunaraTeomSlateStyle"));
+const TCHAR* const FLunaraTeomSlateStyle::AssetPath = TEXT("/Game/UI/Styles/LunaraStyle.LunaraStyle");
 
-static FSlateFontInfo ToFont(TSoftObjectPtr<UFontFace> Face, int32 Size)
+static FSlateFontInfo ToFont(const TSoftObjectPtr<UFontFace>& Face, int32 Size, bool bAllowSyncLoad, const FSlateFontInfo& Current, bool& bOutResolved)
 {
-	if (UFontFace* Resolved = Face.LoadSynchronous()) return FSlateFontInfo(Resolved, Size);
+	UFontFace* Resolved = bAllowSyncLoad ? Face.LoadSynchronous() : Face.Get();
+	if (Resolved) return FSlateFontInfo(Resolved, Size);
+
+	// A null reference has nothing to wait for; only a pending face keeps the style unresolved.
+	bOutResolved &= Face.IsNull();
+
+	// A pending face keeps the font the style already has, e.g. the one saved with a style asset.
+	if (!Face.IsNull() && Current.HasValidFont()) return Current;
 	return FCoreStyle::GetDefaultFontStyle("Regular", Size);
 }
 
 FLunaraTeomSlateStyle::FLunaraTeomSlateStyle()
 {
-	CinzelRegular   = ToFont(CinzelRegularFace,   DefaultFontSize);
-	CinzelMedium    = ToFont(CinzelMediumFace,    DefaultFontSize);
-	CinzelSemiBold  = ToFont(CinzelSemiBoldFace,  DefaultFontSize);
-	CinzelBold      = ToFont(CinzelBoldFace,      DefaultFontSize);
-	CinzelExtraBold = ToFont(CinzelExtraBoldFace, DefaultFontSize);
-	CinzelBlack     = ToFont(CinzelBlackFace,     DefaultFontSize);
+	ResolveFonts(true);
+}
+
+FLunaraTeomSlateStyle::FLunaraTeomSlateStyle(EDeferFontResolve)
+{
+	ResolveFonts(false);
 }
 
 FLunaraTeomSlateStyle::~FLunaraTeomSlateStyle() {}
 
+bool FLunaraTeomSlateStyle::ResolveFonts(bool bAllowSyncLoad)
+{
+	bool bResolved = true;
+	CinzelRegular   = ToFont(CinzelRegularFace,   DefaultFontSize, bAllowSyncLoad, CinzelRegular,   bResolved);
+	CinzelMedium    = ToFont(CinzelMediumFace,    DefaultFontSize, bAllowSyncLoad, CinzelMedium,    bResolved);
+	CinzelSemiBold  = ToFont(CinzelSemiBoldFace,  DefaultFontSize, bAllowSyncLoad, CinzelSemiBold,  bResolved);
+	CinzelBold      = ToFont(CinzelBoldFace,      DefaultFontSize, bAllowSyncLoad, CinzelBold,      bResolved);
+	CinzelExtraBold = ToFont(CinzelExtraBoldFace, DefaultFontSize, bAllowSyncLoad, CinzelExtraBold, bResolved);
+	CinzelBlack     = ToFont(CinzelBlackFace,     DefaultFontSize, bAllowSyncLoad, CinzelBlack,     bResolved);
+
+	// A synchronous pass is final even if a face is missing, so GetDefault() does not retry every call.
+	bFontsResolved = bResolved || bAllowSyncLoad;
+	return bResolved;
+}
+
+void FLunaraTeomSlateStyle::PostSerialize(const FArchive& Ar)
+{
+	// The constructor ran before the face references were loaded. No sync loads while async loading
+	// is in flight; the warm-up streams the faces before it streams the style asset.
+	if (Ar.IsLoading())
+	{
+		ResolveFonts(!IsAsyncLoading());
+	}
+}
+
+void FLunaraTeomSlateStyle::GetFontFacePaths(TArray<FSoftObjectPath>& OutPaths) const
+{
+	for (const TSoftObjectPtr<UFontFace>* Face : { &CinzelRegularFace, &CinzelMediumFace, &CinzelSemiBoldFace, &CinzelBoldFace, &CinzelExtraBoldFace, &CinzelBlackFace })
+	{
+		if (!Face->IsNull()) OutPaths.AddUnique(Face->ToSoftObjectPath());
+	}
+}
+
+void FLunaraTeomSlateStyle::GetRuntimeFonts(TArray<const FSlateFontInfo*>& OutFonts) const
+{
+	OutFonts.Append({ &CinzelRegular, &CinzelMedium, &CinzelSemiBold, &CinzelBold, &CinzelExtraBold, &CinzelBlack });
+}
+
+FLunaraTeomSlateStyle& FLunaraTeomSlateStyle::GetMutableDefault()
+{
+	static FLunaraTeomSlateStyle Default(EDeferFontResolve::Tag);
+	return Default;
+}
+
 const FLunaraTeomSlateStyle& FLunaraTeomSlateStyle::GetDefault()
 {
-	static FLunaraTeomSlateStyle Default;
+	FLunaraTeomSlateStyle& Default = GetMutableDefault();
+
+	// Fallback for when nothing warmed the style up front: resolve in-frame, as before.
+	if (!Default.bFontsResolved) Default.ResolveFonts(true);
 	return Default;
 }
 
@@ -0,0 +1,230 @@
+#include "UI/Style/LunaraTeomStyleWarmUp.h"
+
+#include "UI/Style/LunaraTeomSlateWidgetStyle.h"
+
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+#include "Fonts/FontCache.h"
+#include "Framework/Application/SlateApplication.h"
+#include "HAL/IConsoleManager.h"
+#include "Rendering/SlateRenderer.h"
+#include "Styling/SlateWidgetStyleAsset.h"
+
+namespace LunaraTeomStyleWarmUpPrivate
+{
+    /** Point sizes used by text buttons and window titles; the style default size is added on top. */
+    static const int32 StockFontSizes[] = { 18, 20 };
+
+    /** The style inside the LunaraStyle asset, if that asset is loaded; never loads it. */
+    static const FLunaraTeomSlateStyle* FindStyleAssetStyle()
+    {
+        const USlateWidgetStyleAsset* StyleAsset = Cast<USlateWidgetStyleAsset>(FSoftObjectPath(FLunaraTeomSlateStyle::AssetPath).ResolveObject());
+        return StyleAsset ? StyleAsset->GetStyle<FLunaraTeomSlateStyle>() : nullptr;
+    }
+
+    /** Printable ASCII plus Latin-1 Supplement; covers the UI copy of every shipped culture. */
+    static const FString& GetWarmGlyphs()
+    {
+        static const FString Glyphs = []()
+        {
+            FString Result;
+            Result.Reserve((0x7E - 0x20 + 1) + (0xFF - 0xA1 + 1));
+            for (TCHAR Ch = 0x20; Ch <= 0x7E; ++Ch)
+            {
+                Result.AppendChar(Ch);
+            }
+            for (TCHAR Ch = 0xA1; Ch <= 0xFF; ++Ch)
+            {
+                Result.AppendChar(Ch);
+            }
+            return Result;
+        }();
+        return Glyphs;
+    }
+
+    static FAutoConsoleCommand WarmUpCommand(
+        TEXT("Lunara.UI.Style.WarmUp"),
+        TEXT("Streams the Lunara style fonts and pre-rasterizes their common glyphs."),
+        FConsoleCommandDelegate::CreateLambda([]()
+        {
+            const double StartSeconds = FPlatformTime::Seconds();
+            FLunaraTeomStyleWarmUp::Get().Start(FSimpleDelegate::CreateLambda([StartSeconds]()
+            {
+                UE_LOG(LogTemp, Display, TEXT("LunaraTeomStyleWarmUp: finished in %.1f ms"), (FPlatformTime::Seconds() - StartSeconds) * 1000.0);
+            }));
+        }));
+}
+
+FLunaraTeomStyleWarmUp& FLunaraTeomStyleWarmUp::Get()
+{
+    static FLunaraTeomStyleWarmUp Instance;
+    return Instance;
+}
+
+void FLunaraTeomStyleWarmUp::Start(FSimpleDelegate OnComplete, const TArray<int32>& FontSizes)
+{
+    check(IsInGameThread());
+
+    if (State == EState::Complete)
+    {
+        OnComplete.ExecuteIfBound();
+        return;
+    }
+
+    if (OnComplete.IsBound())
+    {
+        CompletionWaiters.Add(MoveTemp(OnComplete));
+    }
+
+    if (State != EState::Idle)
+    {
+        return;
+    }
+
+    const FLunaraTeomSlateStyle& Style = FLunaraTeomSlateStyle::GetMutableDefault();
+
+    WarmFontSizes.Reset();
+    if (FontSizes.Num() > 0)
+    {
+        for (int32 Size : FontSizes)
+        {
+            WarmFontSizes.AddUnique(FMath::Max(1, Size));
+        }
+    }
+    else
+    {
+        WarmFontSizes.Add(Style.DefaultFontSize);
+        for (int32 Size : LunaraTeomStyleWarmUpPrivate::StockFontSizes)
+        {
+            WarmFontSizes.AddUnique(Size);
+        }
+    }
+
+    TArray<FSoftObjectPath> FacePaths;
+    Style.GetFontFacePaths(FacePaths);
+
+    State = EState::Streaming;
+
+    if (FacePaths.Num() == 0)
+    {
+        HandleFacesLoaded();
+        return;
+    }
+
+    // The handle is kept for the lifetime of the process: the style's fonts reference the faces
+    // through raw pointers, so the streamable handle is what keeps them from being collected.
+    FacesHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+        FacePaths,
+        FStreamableDelegate::CreateRaw(this, &FLunaraTeomStyleWarmUp::HandleFacesLoaded),
+        FStreamableManager::AsyncLoadHighPriority);
+
+    if (!FacesHandle.IsValid())
+    {
+        HandleFacesLoaded();
+    }
+}
+
+void FLunaraTeomStyleWarmUp::HandleFacesLoaded()
+{
+    if (State != EState::Streaming)
+    {
+        return;
+    }
+
+    // Faces that failed to stream are not retried here; GetDefault() falls back to a sync load.
+    FLunaraTeomSlateStyle::GetMutableDefault().ResolveFonts(false);
+
+    // The asset is streamed only now, so its style's PostSerialize finds the faces already resident.
+    if (LunaraTeomStyleWarmUpPrivate::FindStyleAssetStyle() == nullptr)
+    {
+        StyleAssetHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+            FSoftObjectPath(FLunaraTeomSlateStyle::AssetPath),
+            FStreamableDelegate::CreateRaw(this, &FLunaraTeomStyleWarmUp::HandleStyleAssetLoaded),
+            FStreamableManager::AsyncLoadHighPriority);
+
+        if (StyleAssetHandle.IsValid())
+        {
+            return;
+        }
+    }
+
+    HandleStyleAssetLoaded();
+}
+
+void FLunaraTeomStyleWarmUp::HandleStyleAssetLoaded()
+{
+    if (State != EState::Streaming)
+    {
+        return;
+    }
+
+    TArray<const FSlateFontInfo*> RuntimeFonts;
+    FLunaraTeomSlateStyle::GetMutableDefault().GetRuntimeFonts(RuntimeFonts);
+
+    // Widgets read the asset's style before GetDefault(), so its fonts are warmed too.
+    if (const FLunaraTeomSlateStyle* AssetStyle = LunaraTeomStyleWarmUpPrivate::FindStyleAssetStyle())
+    {
+        AssetStyle->GetRuntimeFonts(RuntimeFonts);
+    }
+
+    PendingFonts.Reset();
+    for (const FSlateFontInfo* Font : RuntimeFonts)
+    {
+        for (int32 Size : WarmFontSizes)
+        {
+            FSlateFontInfo SizedFont = *Font;
+            SizedFont.Size = Size;
+            PendingFonts.AddUnique(MoveTemp(SizedFont));
+        }
+    }
+
+    if (!FSlateApplication::IsInitialized() || PendingFonts.Num() == 0)
+    {
+        Finish();
+        return;
+    }
+
+    State = EState::Rasterizing;
+    RasterizeTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+        FTickerDelegate::CreateRaw(this, &FLunaraTeomStyleWarmUp::TickRasterize));
+}
+
+bool FLunaraTeomStyleWarmUp::TickRasterize(float DeltaTime)
+{
+    if (PendingFonts.Num() == 0 || !FSlateApplication::IsInitialized())
+    {
+        RasterizeTickerHandle.Reset();
+        Finish();
+        return false;
+    }
+
+    // One font/size pair per frame keeps each step well under a frame's budget.
+    const FSlateFontInfo Font = PendingFonts.Pop(EAllowShrinking::No);
+
+    const TSharedRef<FSlateFontCache> FontCache = FSlateApplication::Get().GetRenderer()->GetFontCache();
+    const float FontScale = FSlateApplication::Get().GetApplicationScale();
+    const FString& Glyphs = LunaraTeomStyleWarmUpPrivate::GetWarmGlyphs();
+
+    const FShapedGlyphSequenceRef Sequence = FontCache->ShapeBidirectionalText(
+        *Glyphs, 0, Glyphs.Len(), Font, FontScale, TextBiDi::ETextDirection::LeftToRight, ETextShapingMethod::Auto);
+
+    for (const FShapedGlyphEntry& Glyph : Sequence->GetGlyphsToRender())
+    {
+        FontCache->GetShapedGlyphFontAtlasData(Glyph, Font.OutlineSettings);
+    }
+
+    return true;
+}
+
+void FLunaraTeomStyleWarmUp::Finish()
+{
+    State = EState::Complete;
+    PendingFonts.Empty();
+
+    TArray<FSimpleDelegate> Waiters = MoveTemp(CompletionWaiters);
+    CompletionWaiters.Reset();
+    for (FSimpleDelegate& Waiter : Waiters)
+    {
+        Waiter.ExecuteIfBound();
+    }
+}
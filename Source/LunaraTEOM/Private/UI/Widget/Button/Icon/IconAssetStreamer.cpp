@@ -0,0 +1,140 @@
+#include "UI/Widget/Button/Icon/IconAssetStreamer.h"
+
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+
+FIconAssetStreamer& FIconAssetStreamer::Get()
+{
+    static FIconAssetStreamer Instance;
+    return Instance;
+}
+
+void FIconAssetStreamer::RequestIcon(const FSoftObjectPath& Path, FOnIconAssetStreamed&& OnStreamed)
+{
+    check(IsInGameThread());
+
+    if (Path.IsNull())
+    {
+        OnStreamed.ExecuteIfBound(nullptr);
+        return;
+    }
+
+    if (UObject* Resident = Path.ResolveObject())
+    {
+        OnStreamed.ExecuteIfBound(Resident);
+        return;
+    }
+
+    TArray<FOnIconAssetStreamed>* PathWaiters = Waiters.Find(Path);
+    if (!PathWaiters)
+    {
+        PathWaiters = &Waiters.Add(Path);
+        PendingPaths.Add(Path);
+    }
+    PathWaiters->Add(MoveTemp(OnStreamed));
+
+    // Everything requested this frame goes out as one streamable request on the next ticker pass.
+    if (!FlushTickerHandle.IsValid() && PendingPaths.Num() > 0)
+    {
+        FlushTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+            FTickerDelegate::CreateRaw(this, &FIconAssetStreamer::FlushPendingRequests));
+    }
+}
+
+bool FIconAssetStreamer::FlushPendingRequests(float DeltaTime)
+{
+    FlushTickerHandle.Reset();
+
+    if (PendingPaths.Num() == 0)
+    {
+        return false;
+    }
+
+    TArray<FSoftObjectPath> BatchPaths = MoveTemp(PendingPaths);
+    PendingPaths.Reset();
+
+    FStreamableManager& Streamable = UAssetManager::GetStreamableManager();
+    TSharedPtr<FStreamableHandle> Handle = Streamable.RequestAsyncLoad(
+        BatchPaths,
+        FStreamableDelegate::CreateRaw(this, &FIconAssetStreamer::HandleBatchLoaded, BatchPaths),
+        FStreamableManager::AsyncLoadHighPriority);
+
+    if (!Handle.IsValid())
+    {
+        // The streamable manager rejected the batch (e.g. invalid paths); fail the waiters now.
+        HandleBatchLoaded(BatchPaths);
+    }
+
+    return false;
+}
+
+void FIconAssetStreamer::HandleBatchLoaded(TArray<FSoftObjectPath> BatchPaths)
+{
+    for (const FSoftObjectPath& Path : BatchPaths)
+    {
+        TArray<FOnIconAssetStreamed> PathWaiters;
+        if (!Waiters.RemoveAndCopyValue(Path, PathWaiters))
+        {
+            continue;
+        }
+
+        UObject* Loaded = Path.ResolveObject();
+
+#if !UE_BUILD_SHIPPING
+        if (!Loaded)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("FIconAssetStreamer: Failed to stream icon %s"), *Path.ToString());
+        }
+#endif
+
+        for (FOnIconAssetStreamed& Waiter : PathWaiters)
+        {
+            Waiter.ExecuteIfBound(Loaded);
+        }
+    }
+}
+
+void FIconAssetStreamer::Prefetch(const TArray<TSoftObjectPtr<UObject>>& Icons, FSimpleDelegate OnComplete)
+{
+    TArray<FSoftObjectPath> Paths;
+    Paths.Reserve(Icons.Num());
+
+    for (const TSoftObjectPtr<UObject>& Icon : Icons)
+    {
+        if (!Icon.IsNull())
+        {
+            Paths.AddUnique(Icon.ToSoftObjectPath());
+        }
+    }
+
+    if (Paths.Num() == 0)
+    {
+        OnComplete.ExecuteIfBound();
+        return;
+    }
+
+    FStreamableManager& Streamable = UAssetManager::GetStreamableManager();
+    TSharedPtr<FStreamableHandle> Handle = Streamable.RequestAsyncLoad(Paths, OnComplete, FStreamableManager::DefaultAsyncLoadPriority);
+
+    if (Handle.IsValid())
+    {
+        PrefetchHandles.Add(Handle);
+    }
+    else
+    {
+        OnComplete.ExecuteIfBound();
+    }
+}
+
+void FIconAssetStreamer::ReleasePrefetched()
+{
+    for (const TSharedPtr<FStreamableHandle>& Handle : PrefetchHandles)
+    {
+        if (Handle.IsValid())
+        {
+            Handle->ReleaseHandle();
+        }
+    }
+
+    PrefetchHandles.Reset();
+}
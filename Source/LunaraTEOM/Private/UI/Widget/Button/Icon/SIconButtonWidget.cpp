@@ -1,7 +1,10 @@
 #include "UI/Widget/Button/Icon/SIconButtonWidget.h"
 
+#include "UI/Widget/Button/Icon/IconAssetStreamer.h"
+
 #include "Styling/CoreStyle.h"
 #include "Styling/SlateBrush.h"
+#include "Brushes/SlateRoundedBoxBrush.h"
 
 #include "Widgets/Input/SButton.h"
 #include "Widgets/Images/SImage.h"
@@ -20,6 +23,11 @@
 
 #include "SlateOptMacros.h"
 
+namespace IconButtonWidgetPrivate
+{
+    static const FSlateRoundedBoxBrush DefaultPlaceholderBrush(FLinearColor(1.f, 1.f, 1.f, 0.15f), 0.5f);
+}
+
 BEGIN_SLATE_FUNCTION_BUILD_OPTIMIZATION
 
 void SIconButtonWidget::Construct(const FArguments& InArgs)
@@ -34,6 +42,8 @@ void SIconButtonWidget::Construct(const FArguments& InArgs)
 
     IconAsset      = InArgs._IconAsset;
     ButtonDiameter = FMath::Max(12.f, InArgs._Diameter);
+    bAsyncLoadIcon = InArgs._AsyncLoadIcon;
+    PlaceholderBrush = InArgs._PlaceholderBrush ? InArgs._PlaceholderBrush : &IconButtonWidgetPrivate::DefaultPlaceholderBrush;
 
     HoverSeq = FCurveSequence();
     HoverAlpha = HoverSeq.AddCurve(0.f, 0.12f, ECurveEaseFunction::QuadInOut);
@@ -86,7 +96,16 @@ void SIconButtonWidget::SetDiameter(float InDiameter)
         IconBox->SetHeightOverride(ButtonDiameter * IconScale);
     }
 
-    RefreshIconBrush();
+    // Only the brush size depends on the diameter; reuse the already resolved asset instead of loading again.
+    if (!bIconStreaming)
+    {
+        ApplyIconObject(ResolvedIconObject.Get());
+    }
+}
+
+void SIconButtonWidget::SetAsyncLoadIcon(bool bInAsyncLoad)
+{
+    bAsyncLoadIcon = bInAsyncLoad;
 }
 
 FReply SIconButtonWidget::HandleClick()
@@ -179,11 +198,65 @@ TOptional<FSlateRenderTransform> SIconButtonWidget::GetButtonRenderTransform() c
 
 void SIconButtonWidget::RefreshIconBrush()
 {
+    bIconStreaming = false;
+
+    if (IconAsset.IsNull())
+    {
+        ApplyIconObject(nullptr);
+        return;
+    }
+
+    if (UObject* Resident = IconAsset.Get())
+    {
+        ApplyIconObject(Resident);
+        return;
+    }
+
+    if (!bAsyncLoadIcon)
+    {
+        ApplyIconObject(IconAsset.LoadSynchronous());
+        return;
+    }
+
+    bIconStreaming = true;
+    ShowPlaceholderIcon();
+
+    const FSoftObjectPath RequestedPath = IconAsset.ToSoftObjectPath();
+    FIconAssetStreamer::Get().RequestIcon(
+        RequestedPath,
+        FOnIconAssetStreamed::CreateSP(this, &SIconButtonWidget::HandleIconStreamed, RequestedPath));
+}
+
+void SIconButtonWidget::HandleIconStreamed(UObject* LoadedAsset, FSoftObjectPath RequestedPath)
+{
+    // The icon may have been swapped while this request was in flight.
+    if (!bIconStreaming || IconAsset.ToSoftObjectPath() != RequestedPath)
+    {
+        return;
+    }
+
+    bIconStreaming = false;
+    ApplyIconObject(LoadedAsset);
+}
+
+void SIconButtonWidget::ShowPlaceholderIcon()
+{
+    ResolvedIconObject.Reset();
+
+    if (IconImage.IsValid())
+    {
+        IconImage->SetImage(PlaceholderBrush);
+        IconImage->SetVisibility(PlaceholderBrush ? EVisibility::Visible : EVisibility::Collapsed);
+    }
+}
+
+void SIconButtonWidget::ApplyIconObject(UObject* IconObject)
+{
+    ResolvedIconObject = IconObject;
+
     IconBrush = FSlateBrush();
     IconBrush.DrawAs = ESlateBrushDrawType::Image;
 
-    UObject* IconObject = IconAsset.IsNull() ? nullptr : IconAsset.LoadSynchronous();
-
 #if !UE_BUILD_SHIPPING
     if (IconObject)
     {
@@ -16,6 +16,88 @@
 
 #include "SlateOptMacros.h"
 
+namespace IconButtonLayoutPrivate
+{
+    /**
+     * Unit-circle fan for a notched fill: per-segment direction, notch weight and shading,
+     * computed once per (segment count, notch half angle) and scaled at paint time.
+     */
+    struct FNotchedCircleTemplate
+    {
+        int32 SegmentCount = 0;
+        float NotchHalfAngle = 0.f;
+        TArray<FVector2f> Directions;
+        TArray<float> NotchWeights;
+        TArray<float> ShadeFactors;
+        TArray<SlateIndex> Indices;
+    };
+
+    static const FNotchedCircleTemplate& GetNotchedCircleTemplate(int32 SegmentCount, float NotchHalfAngle)
+    {
+        check(IsInGameThread());
+
+        static TArray<TUniquePtr<FNotchedCircleTemplate>> Templates;
+        for (const TUniquePtr<FNotchedCircleTemplate>& Existing : Templates)
+        {
+            if (Existing->SegmentCount == SegmentCount && Existing->NotchHalfAngle == NotchHalfAngle)
+            {
+                return *Existing;
+            }
+        }
+
+        TUniquePtr<FNotchedCircleTemplate> Template = MakeUnique<FNotchedCircleTemplate>();
+        Template->SegmentCount = SegmentCount;
+        Template->NotchHalfAngle = NotchHalfAngle;
+        Template->Directions.Reserve(SegmentCount);
+        Template->NotchWeights.Reserve(SegmentCount);
+        Template->ShadeFactors.Reserve(SegmentCount);
+        Template->Indices.Reserve(SegmentCount * 3);
+
+        const float NotchAngles[4] = { 0.f, PI * 0.5f, PI, PI * 1.5f };
+
+        for (int32 i = 0; i < SegmentCount; ++i)
+        {
+            const float Angle = (2.f * PI * i) / SegmentCount;
+            float Weight = 0.f;
+
+            for (float NotchAngle : NotchAngles)
+            {
+                const float Dist = FMath::Abs(FMath::FindDeltaAngleRadians(Angle, NotchAngle));
+                if (Dist < NotchHalfAngle)
+                {
+                    Weight = FMath::Max(Weight, 1.f - (Dist / NotchHalfAngle));
+                }
+            }
+
+            Template->Directions.Add(FVector2f(FMath::Cos(Angle), FMath::Sin(Angle)));
+            Template->NotchWeights.Add(Weight);
+            Template->ShadeFactors.Add(FMath::Clamp(1.f + 0.18f * FMath::Sin(Angle), 0.75f, 1.2f));
+        }
+
+        // The fan center is appended after the rim vertices at paint time.
+        for (int32 i = 0; i < SegmentCount; ++i)
+        {
+            Template->Indices.Add(SegmentCount);
+            Template->Indices.Add(i);
+            Template->Indices.Add((i + 1) % SegmentCount);
+        }
+
+        return *Templates.Add_GetRef(MoveTemp(Template));
+    }
+
+    /** Rounded box that always rounds to half its height, i.e. a circle for the square boxes painted here. */
+    static const FSlateBrush& GetCircleBrush()
+    {
+        static const FSlateRoundedBoxBrush CircleBrush = []()
+        {
+            FSlateRoundedBoxBrush Brush(FLinearColor::White, 0.f);
+            Brush.OutlineSettings.RoundingType = ESlateBrushRoundingType::HalfHeightRadius;
+            return Brush;
+        }();
+        return CircleBrush;
+    }
+}
+
 BEGIN_SLATE_FUNCTION_BUILD_OPTIMIZATION
 
 void SIconButtonWidget::BuildLayout()
@@ -98,8 +180,6 @@ int32 SIconButtonWidget::OnPaint(const FPaintArgs& Args,
     const FLinearColor InnerColor = GetInnerStrokeColor() * Tint;
     const FLinearColor FillColor  = GetFillColor() * Tint;
 
-    const float OuterRadius = Diameter * 0.5f;
-    const float MiddleRadius = FMath::Max(1.f, MiddleSize.X * 0.5f);
     const float InnerRadius  = FMath::Max(1.f, InnerSize.X * 0.5f);
 
     const FVector2D ShadowOffset(2.f, 2.f);
@@ -110,30 +190,23 @@ int32 SIconButtonWidget::OnPaint(const FPaintArgs& Args,
         return AllottedGeometry.ToPaintGeometry(FVector2f(LocalSize), FSlateLayoutTransform(Offset));
     };
 
-    auto PaintCircle = [&](int32& InLayer, const FVector2D& Offset, const FVector2D& CircSize, float Radius, const FLinearColor& Color)
+    const FSlateBrush* CircleBrush = &IconButtonLayoutPrivate::GetCircleBrush();
+
+    auto PaintCircle = [&](int32& InLayer, const FVector2D& Offset, const FVector2D& CircSize, const FLinearColor& Color)
     {
-        FSlateRoundedBoxBrush Brush(Color, Radius);
         FSlateDrawElement::MakeBox(
             OutDrawElements,
             InLayer++,
             ToGeometry(Offset, CircSize),
-            &Brush,
+            CircleBrush,
             ESlateDrawEffect::None,
             Color);
     };
 
-    auto PaintCircleWithShadow = [&](int32& InLayer, const FVector2D& Offset, const FVector2D& CircSize, float Radius, const FLinearColor& Color)
+    auto PaintCircleWithShadow = [&](int32& InLayer, const FVector2D& Offset, const FVector2D& CircSize, const FLinearColor& Color)
     {
-        FSlateRoundedBoxBrush ShadowBrush(ShadowColor, Radius);
-        FSlateDrawElement::MakeBox(
-            OutDrawElements,
-            InLayer++,
-            ToGeometry(Offset + ShadowOffset, CircSize),
-            &ShadowBrush,
-            ESlateDrawEffect::None,
-            ShadowColor);
-
-        PaintCircle(InLayer, Offset, CircSize, Radius, Color);
+        PaintCircle(InLayer, Offset + ShadowOffset, CircSize, ShadowColor);
+        PaintCircle(InLayer, Offset, CircSize, Color);
     };
 
     auto PaintNotchedFill = [&](int32& InLayer, const FVector2D& Offset, const FVector2D& CircSize, float BaseRadius, float MaxRadius, float NotchDepth, float NotchHalfAngle, const FLinearColor& BaseColor)
@@ -141,66 +214,44 @@ int32 SIconButtonWidget::OnPaint(const FPaintArgs& Args,
         const FVector2f LocalCenter(CircSize * 0.5f);
         constexpr int32 SegmentCount = 96;
 
-        TArray<FSlateVertex> Vertices;
-        TArray<SlateIndex> Indices;
-        Vertices.Reserve(SegmentCount + 1);
-        Indices.Reserve(SegmentCount * 3);
+        const IconButtonLayoutPrivate::FNotchedCircleTemplate& Template =
+            IconButtonLayoutPrivate::GetNotchedCircleTemplate(SegmentCount, NotchHalfAngle);
 
         const float AllowedGrowth = FMath::Max(0.f, MaxRadius - BaseRadius);
         const float MaxDepth = FMath::Clamp(NotchDepth, 0.f, AllowedGrowth);
 
-        const float NotchAngles[4] = { 0.f, PI * 0.5f, PI, PI * 1.5f };
-
         const FPaintGeometry FillGeometry = AllottedGeometry.ToPaintGeometry(FVector2f::ZeroVector, FSlateLayoutTransform(Offset));
         const FSlateRenderTransform FillTransform = FillGeometry.GetAccumulatedRenderTransform();
 
+        NotchedFillVertices.SetNumUninitialized(SegmentCount + 1, EAllowShrinking::No);
+
         for (int32 i = 0; i < SegmentCount; ++i)
         {
-            const float Angle = (2.f * PI * i) / SegmentCount;
-            float Growth = 0.f;
-
-            for (float NotchAngle : NotchAngles)
-            {
-                const float Dist = FMath::Abs(FMath::FindDeltaAngleRadians(Angle, NotchAngle));
-                if (Dist < NotchHalfAngle)
-                {
-                    const float Weight = 1.f - (Dist / NotchHalfAngle);
-                    Growth = FMath::Max(Growth, MaxDepth * Weight);
-                }
-            }
-
-            float Radius = BaseRadius + Growth;
+            float Radius = BaseRadius + (MaxDepth * Template.NotchWeights[i]);
             Radius = FMath::Min(Radius, MaxRadius);
             Radius = FMath::Max(1.f, Radius);
 
-            const float ShadeFactor = FMath::Clamp(1.f + 0.18f * FMath::Sin(Angle), 0.75f, 1.2f);
-            FLinearColor VertexColor = BaseColor * ShadeFactor;
+            FLinearColor VertexColor = BaseColor * Template.ShadeFactors[i];
             VertexColor.A = BaseColor.A;
 
-            const FVector2f Position = LocalCenter + FVector2f(FMath::Cos(Angle) * Radius, FMath::Sin(Angle) * Radius);
-            Vertices.Add(FSlateVertex::Make(FillTransform, Position, FVector2f::ZeroVector, VertexColor.ToFColor(true)));
+            const FVector2f Position = LocalCenter + (Template.Directions[i] * Radius);
+            NotchedFillVertices[i] = FSlateVertex::Make(FillTransform, Position, FVector2f::ZeroVector, VertexColor.ToFColor(true));
         }
 
-        const int32 CenterIndex = Vertices.Num();
-        Vertices.Add(FSlateVertex::Make(FillTransform, LocalCenter, FVector2f::ZeroVector, BaseColor.ToFColor(true)));
+        NotchedFillVertices[SegmentCount] = FSlateVertex::Make(FillTransform, LocalCenter, FVector2f::ZeroVector, BaseColor.ToFColor(true));
 
-        for (int32 i = 0; i < SegmentCount; ++i)
+        if (!WhiteBrushHandle.IsValid())
         {
-            const int32 Next = (i + 1) % SegmentCount;
-            Indices.Add(CenterIndex);
-            Indices.Add(i);
-            Indices.Add(Next);
+            const FSlateBrush* WhiteBrush = FCoreStyle::Get().GetBrush("WhiteBrush");
+            WhiteBrushHandle = FSlateApplication::Get().GetRenderer()->GetResourceHandle(*WhiteBrush);
         }
 
-        const FSlateBrush* WhiteBrush = FCoreStyle::Get().GetBrush("WhiteBrush");
-        FSlateResourceHandle Handle = FSlateApplication::Get().GetRenderer()->GetResourceHandle(*WhiteBrush);
-
         FSlateDrawElement::MakeCustomVerts(
             OutDrawElements,
             InLayer++,
-            Handle,
-            Vertices,
-            Indices,
+            WhiteBrushHandle,
+            NotchedFillVertices,
+            Template.Indices,
             nullptr,
             0,
             0);
@@ -208,8 +259,8 @@ int32 SIconButtonWidget::OnPaint(const FPaintArgs& Args,
 
     int32 CurrentLayer = LayerId;
 
-    PaintCircleWithShadow(CurrentLayer, OuterOffset, OuterSize, OuterRadius, OuterColor);
-    PaintCircleWithShadow(CurrentLayer, MiddleOffset, MiddleSize, MiddleRadius, InnerColor);
+    PaintCircleWithShadow(CurrentLayer, OuterOffset, OuterSize, OuterColor);
+    PaintCircleWithShadow(CurrentLayer, MiddleOffset, MiddleSize, InnerColor);
 
     const float FillInset   = FMath::Clamp(Diameter * 0.05f, 2.f, InnerRadius * 0.45f);
     const float FillBaseRadius = InnerRadius - FillInset;
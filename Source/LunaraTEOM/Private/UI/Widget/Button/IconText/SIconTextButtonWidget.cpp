@@ -20,59 +20,40 @@ void SIconTextButtonWidget::Construct(const FArguments& InArgs)
     Spacing = FMath::Max(0.f, InArgs._Spacing);
     LabelMaxWidth = FMath::Max(0.f, InArgs._LabelMaxWidth);
 
-    const FSlateBrush* IconBrush = IconBrushAttr.Get(nullptr);
-    const bool bHasIcon = IconBrush != nullptr;
-
-    TSharedRef<SVerticalBox> ContentBox = SNew(SVerticalBox);
-
-    if (bHasIcon)
-    {
-        ContentBox->AddSlot()
+    TSharedRef<SVerticalBox> ContentBox = SNew(SVerticalBox)
+        + SVerticalBox::Slot()
         .AutoHeight()
         .HAlign(HAlign_Center)
         [
-            SNew(SBox)
+            SAssignNew(IconBox, SBox)
             .WidthOverride(IconSize)
             .HeightOverride(IconSize)
             [
-                SNew(SImage)
+                SAssignNew(IconImage, SImage)
                 .Image(IconBrushAttr)
                 .ColorAndOpacity(IconColorAttr)
             ]
-        ];
-    }
-
-    TSharedRef<STextBlock> LabelText = SNew(STextBlock)
-        .Text(LabelAttr)
-        .Font(FontAttr)
-        .Justification(ETextJustify::Center)
-        .AutoWrapText(false)
-        .ColorAndOpacity(LabelColorAttr)
-        .ShadowColorAndOpacity(FLinearColor(0.f, 0.f, 0.f, 0.6f))
-        .ShadowOffset(FVector2D(1.f, 1.f))
-        .WrapTextAt(0.f);
-
-    const bool bHasLabel = !LabelAttr.Get(FText::GetEmpty()).IsEmpty();
-
-    TSharedRef<SWidget> LabelWidget = StaticCastSharedRef<SWidget>(LabelText);
-
-    if (LabelMaxWidth > 0.f)
-    {
-        TSharedRef<SBox> LabelBox = SNew(SBox)
-            .WidthOverride(LabelMaxWidth)
+        ]
+        + SVerticalBox::Slot()
+        .Expose(LabelSlot)
+        .AutoHeight()
+        .HAlign(HAlign_Center)
+        [
+            SAssignNew(LabelBox, SBox)
             [
-                LabelText
-            ];
-        LabelWidget = StaticCastSharedRef<SWidget>(LabelBox);
-    }
+                SAssignNew(LabelText, STextBlock)
+                .Text(LabelAttr)
+                .Font(FontAttr)
+                .Justification(ETextJustify::Center)
+                .AutoWrapText(false)
+                .ColorAndOpacity(LabelColorAttr)
+                .ShadowColorAndOpacity(FLinearColor(0.f, 0.f, 0.f, 0.6f))
+                .ShadowOffset(FVector2D(1.f, 1.f))
+                .WrapTextAt(0.f)
+            ]
+        ];
 
-    ContentBox->AddSlot()
-    .AutoHeight()
-    .HAlign(HAlign_Center)
-    .Padding(FMargin(0.f, (bHasIcon && bHasLabel) ? Spacing : 0.f, 0.f, 0.f))
-    [
-        LabelWidget
-    ];
+    RefreshContentLayout();
 
     ChildSlot
     [
@@ -88,3 +69,78 @@ void SIconTextButtonWidget::Construct(const FArguments& InArgs)
     ];
 }
 END_SLATE_FUNCTION_BUILD_OPTIMIZATION
+
+void SIconTextButtonWidget::SetIconBrush(const TAttribute<const FSlateBrush*>& InIconBrush)
+{
+    IconBrushAttr = InIconBrush;
+
+    if (IconImage.IsValid())
+    {
+        IconImage->SetImage(IconBrushAttr);
+    }
+
+    RefreshContentLayout();
+}
+
+void SIconTextButtonWidget::SetLabel(const TAttribute<FText>& InLabel)
+{
+    LabelAttr = InLabel;
+
+    if (LabelText.IsValid())
+    {
+        LabelText->SetText(LabelAttr);
+    }
+
+    RefreshContentLayout();
+}
+
+void SIconTextButtonWidget::SetFont(const TAttribute<FSlateFontInfo>& InFont)
+{
+    FontAttr = InFont;
+
+    if (LabelText.IsValid())
+    {
+        LabelText->SetFont(FontAttr);
+    }
+}
+
+void SIconTextButtonWidget::SetIconSize(float InIconSize)
+{
+    IconSize = FMath::Max(0.f, InIconSize);
+    RefreshContentLayout();
+}
+
+void SIconTextButtonWidget::SetSpacing(float InSpacing)
+{
+    Spacing = FMath::Max(0.f, InSpacing);
+    RefreshContentLayout();
+}
+
+void SIconTextButtonWidget::SetLabelMaxWidth(float InLabelMaxWidth)
+{
+    LabelMaxWidth = FMath::Max(0.f, InLabelMaxWidth);
+    RefreshContentLayout();
+}
+
+void SIconTextButtonWidget::RefreshContentLayout()
+{
+    const bool bHasIcon = IconBrushAttr.Get(nullptr) != nullptr;
+    const bool bHasLabel = !LabelAttr.Get(FText::GetEmpty()).IsEmpty();
+
+    if (IconBox.IsValid())
+    {
+        IconBox->SetWidthOverride(IconSize);
+        IconBox->SetHeightOverride(IconSize);
+        IconBox->SetVisibility(bHasIcon ? EVisibility::Visible : EVisibility::Collapsed);
+    }
+
+    if (LabelBox.IsValid())
+    {
+        LabelBox->SetWidthOverride(LabelMaxWidth > 0.f ? FOptionalSize(LabelMaxWidth) : FOptionalSize());
+    }
+
+    if (LabelSlot)
+    {
+        LabelSlot->SetPadding(FMargin(0.f, (bHasIcon && bHasLabel) ? Spacing : 0.f, 0.f, 0.f));
+    }
+}
@@ -18,7 +18,7 @@ void STextButtonWidget::ResolveStyle(const FLunaraTeomSlateStyle* InStyle)
     if (!StyleRef)
     {
         if (USlateWidgetStyleAsset* StyleAsset =
-            LoadObject<USlateWidgetStyleAsset>(nullptr, TEXT("/Game/UI/Styles/LunaraStyle.LunaraStyle")))
+            LoadObject<USlateWidgetStyleAsset>(nullptr, FLunaraTeomSlateStyle::AssetPath))
         {
             if (const FLunaraTeomSlateStyle* Resolved = StyleAsset->GetStyle<FLunaraTeomSlateStyle>())
             {
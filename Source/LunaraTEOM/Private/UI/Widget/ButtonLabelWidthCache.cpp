@@ -0,0 +1,112 @@
+#include "UI/Widget/ButtonLabelWidthCache.h"
+
+#include "Fonts/FontMeasure.h"
+#include "HAL/IConsoleManager.h"
+#include "Framework/Application/SlateApplication.h"
+#include "Internationalization/Internationalization.h"
+#include "Rendering/SlateRenderer.h"
+
+namespace ButtonLabelWidthCachePrivate
+{
+    // Labels are short building names; this only guards against unbounded growth from dynamic text.
+    static constexpr int32 MaxEntries = 4096;
+
+    static FAutoConsoleCommand DumpStatsCommand(
+        TEXT("Lunara.UI.LabelWidthCache.Stats"),
+        TEXT("Prints hit/miss counters of the shared button label width cache. Pass 'reset' to clear the counters."),
+        FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+        {
+            FButtonLabelWidthCache& Cache = FButtonLabelWidthCache::Get();
+            const FButtonLabelWidthCache::FStats Stats = Cache.GetStats();
+            UE_LOG(LogTemp, Display, TEXT("ButtonLabelWidthCache: %llu hits, %llu misses, %d entries"), Stats.Hits, Stats.Misses, Stats.Entries);
+
+            if (Args.Num() > 0 && Args[0].Equals(TEXT("reset"), ESearchCase::IgnoreCase))
+            {
+                Cache.ResetStats();
+            }
+        }));
+}
+
+FButtonLabelWidthCache& FButtonLabelWidthCache::Get()
+{
+    static FButtonLabelWidthCache Instance;
+    return Instance;
+}
+
+FButtonLabelWidthCache::FButtonLabelWidthCache()
+{
+    CultureChangedHandle = FInternationalization::Get().OnCultureChanged().AddRaw(this, &FButtonLabelWidthCache::HandleCultureChanged);
+}
+
+FButtonLabelWidthCache::~FButtonLabelWidthCache()
+{
+    if (FInternationalization::IsAvailable())
+    {
+        FInternationalization::Get().OnCultureChanged().Remove(CultureChangedHandle);
+    }
+}
+
+float FButtonLabelWidthCache::Measure(const FText& InText, const FSlateFontInfo& InFont, float InScale)
+{
+    check(IsInGameThread());
+
+    FKey Key;
+    Key.Text = InText.ToString();
+    Key.Font = InFont;
+    Key.Scale = InScale;
+
+    if (const float* Cached = Widths.Find(Key))
+    {
+        ++HitCount;
+        return *Cached;
+    }
+
+    if (!FSlateApplication::IsInitialized())
+    {
+        return 0.f;
+    }
+
+    FSlateRenderer* Renderer = FSlateApplication::Get().GetRenderer();
+    if (!Renderer)
+    {
+        return 0.f;
+    }
+
+    ++MissCount;
+
+    const TSharedRef<FSlateFontMeasure> FontMeasure = Renderer->GetFontMeasureService();
+    const float Width = FontMeasure->Measure(Key.Text, InFont, InScale).X;
+
+    if (Widths.Num() >= ButtonLabelWidthCachePrivate::MaxEntries)
+    {
+        Widths.Reset();
+    }
+
+    Widths.Add(MoveTemp(Key), Width);
+    return Width;
+}
+
+void FButtonLabelWidthCache::InvalidateAll()
+{
+    Widths.Reset();
+}
+
+FButtonLabelWidthCache::FStats FButtonLabelWidthCache::GetStats() const
+{
+    FStats Stats;
+    Stats.Hits = HitCount;
+    Stats.Misses = MissCount;
+    Stats.Entries = Widths.Num();
+    return Stats;
+}
+
+void FButtonLabelWidthCache::ResetStats()
+{
+    HitCount = 0;
+    MissCount = 0;
+}
+
+void FButtonLabelWidthCache::HandleCultureChanged()
+{
+    InvalidateAll();
+}
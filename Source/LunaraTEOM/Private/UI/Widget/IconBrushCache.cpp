@@ -0,0 +1,122 @@
+#include "UI/Widget/IconBrushCache.h"
+
+#include "Engine/Texture2D.h"
+#include "Slate/SlateVectorArtData.h"
+
+#if __has_include("SVGImporter/Public/SVGData.h")
+#define WITH_SVG_IMPORTER 1
+#include "SVGImporter/Public/SVGData.h"
+#else
+#define WITH_SVG_IMPORTER 0
+#endif
+
+namespace IconBrushCachePrivate
+{
+    // Unreferenced brushes are kept around up to this many entries so list rebuilds can reuse them.
+    static constexpr int32 MaxEntries = 256;
+}
+
+FIconBrushCache& FIconBrushCache::Get()
+{
+    static FIconBrushCache Instance;
+    return Instance;
+}
+
+TSharedPtr<FSlateBrush> FIconBrushCache::Acquire(const FSlateBrush& InSource)
+{
+    check(IsInGameThread());
+
+    UObject* SourceObject = InSource.GetResourceObject();
+    TArray<FEntry>& Bucket = EntriesByResource.FindOrAdd(FObjectKey(SourceObject));
+
+    for (const FEntry& Entry : Bucket)
+    {
+        if (Entry.SourceObject.Get() == SourceObject && Entry.Source == InSource)
+        {
+            return Entry.Resolved;
+        }
+    }
+
+    if (EntryCount >= IconBrushCachePrivate::MaxEntries)
+    {
+        Trim();
+    }
+
+    // Trim may have removed the bucket; look it up again before adding.
+    TArray<FEntry>& TargetBucket = EntriesByResource.FindOrAdd(FObjectKey(SourceObject));
+    FEntry& NewEntry = TargetBucket.Add_GetRef(FEntry{ InSource, SourceObject, Resolve(InSource) });
+    ++EntryCount;
+
+    return NewEntry.Resolved;
+}
+
+void FIconBrushCache::Trim()
+{
+    for (auto It = EntriesByResource.CreateIterator(); It; ++It)
+    {
+        TArray<FEntry>& Bucket = It.Value();
+        for (int32 Index = Bucket.Num() - 1; Index >= 0; --Index)
+        {
+            const FEntry& Entry = Bucket[Index];
+            const bool bUnreferenced = Entry.Resolved.GetSharedReferenceCount() <= 1;
+            const bool bResourceGone = Entry.Source.GetResourceObject() != nullptr && !Entry.SourceObject.IsValid();
+
+            if (bUnreferenced || bResourceGone)
+            {
+                Bucket.RemoveAtSwap(Index, EAllowShrinking::No);
+                --EntryCount;
+            }
+        }
+
+        if (Bucket.Num() == 0)
+        {
+            It.RemoveCurrent();
+        }
+    }
+}
+
+int32 FIconBrushCache::Num() const
+{
+    return EntryCount;
+}
+
+TSharedRef<FSlateBrush> FIconBrushCache::Resolve(const FSlateBrush& InSource)
+{
+    TSharedRef<FSlateBrush> IconBrush = MakeShared<FSlateBrush>(InSource);
+    if (IconBrush->DrawAs == ESlateBrushDrawType::NoDrawType)
+    {
+        IconBrush->DrawAs = ESlateBrushDrawType::Image;
+    }
+
+    if (UObject* Resource = IconBrush->GetResourceObject())
+    {
+        if (USlateVectorArtData* VectorArt = Cast<USlateVectorArtData>(Resource))
+        {
+            IconBrush->ImageType = ESlateBrushImageType::Vector;
+            IconBrush->SetResourceObject(VectorArt);
+        }
+#if WITH_SVG_IMPORTER
+        else if (const USVGData* SVGData = Cast<USVGData>(Resource))
+        {
+            if (UTexture2D* SVGTexture = SVGData->SVGTexture)
+            {
+#if !UE_BUILD_SHIPPING
+                UE_LOG(LogTemp, Verbose, TEXT("FIconBrushCache: Rebinding SVGData %s to texture %s"),
+                    *SVGData->GetName(),
+                    *SVGTexture->GetName());
+#endif
+                IconBrush->SetResourceObject(SVGTexture);
+                IconBrush->ImageType = ESlateBrushImageType::FullColor;
+            }
+#if !UE_BUILD_SHIPPING
+            else
+            {
+                UE_LOG(LogTemp, Warning, TEXT("FIconBrushCache: SVGData %s has no SVGTexture"), *SVGData->GetName());
+            }
+#endif
+        }
+#endif
+    }
+
+    return IconBrush;
+}
@@ -13,6 +13,7 @@ void SBeveledBorder::Construct(const FArguments& InArgs)
     NotchHeightAttr = InArgs._NotchHeight;
     RightNotchCountAttr = InArgs._RightNotchCount;
     LeftNotchCountAttr  = InArgs._LeftNotchCount;
+    Layers              = InArgs._Layers;
 
     ChildSlot
     .Padding(PaddingAttr)
@@ -31,23 +32,152 @@ int32 SBeveledBorder::OnPaint(
     bool bParentEnabled) const
 {
     const FVector2D S = Geo.GetLocalSize();
-    const float W = S.X, H = S.Y;
+    const FLinearColor Tint = Style.GetColorAndOpacityTint();
 
-    const float B  = FMath::Clamp(BevelAttr.Get(), 0.f, 0.5f * FMath::Min(W, H));
-    const float ND = FMath::Max(0.f, NotchDepthAttr.Get());
-    const float NH = FMath::Max(0.f, NotchHeightAttr.Get());
+    if (Layers.Num() == 0)
+    {
+        const float B  = FMath::Clamp(BevelAttr.Get(), 0.f, 0.5f * FMath::Min(S.X, S.Y));
+        const float ND = FMath::Max(0.f, NotchDepthAttr.Get());
+        const float NH = FMath::Max(0.f, NotchHeightAttr.Get());
+
+        if (B <= 0.5f || ND <= 0.5f || NH <= 0.5f)
+        {
+            const FSlateBrush* White = FCoreStyle::Get().GetBrush("WhiteBrush");
+            FSlateDrawElement::MakeBox(Out, LayerId, Geo.ToPaintGeometry(), White, ESlateDrawEffect::None, ColorAttr.Get() * Tint);
+            return SCompoundWidget::OnPaint(Args, Geo, CullingRect, Out, LayerId + 1, Style, bParentEnabled);
+        }
+    }
+
+    FResolvedLayerArray ResolvedLayers;
+    ResolveLayers(FVector2f(S), ResolvedLayers);
 
-    const FLinearColor LinCol = ColorAttr.Get() * Style.GetColorAndOpacityTint();
+    const int32 RightCount = FMath::Max(0, RightNotchCountAttr.Get());
+    const int32 LeftCount  = FMath::Max(0, LeftNotchCountAttr.Get());
 
-    if (B <= 0.5f || ND <= 0.5f || NH <= 0.5f)
+    if (!IsMeshCacheValid(ResolvedLayers, RightCount, LeftCount))
+    {
+        TessellateLayers(ResolvedLayers, RightCount, LeftCount);
+    }
+
+    if (CachedPoints.Num() == 0 || CachedIndices.Num() == 0)
     {
-        const FSlateBrush* White = FCoreStyle::Get().GetBrush("WhiteBrush");
-        FSlateDrawElement::MakeBox(Out, LayerId, Geo.ToPaintGeometry(), White, ESlateDrawEffect::None, LinCol);
         return SCompoundWidget::OnPaint(Args, Geo, CullingRect, Out, LayerId + 1, Style, bParentEnabled);
     }
 
-    const float AvailableHeight = FMath::Max(0.f, H - (2.f * B));
-    const float ClampedND = FMath::Clamp(ND, 0.f, FMath::Max(0.f, (W * 0.5f) - B));
+    // Only the render transform and tint change between paints; apply them to the cached local mesh.
+    TArray<FColor, TInlineAllocator<8>> OpaqueColors;
+    TArray<FColor, TInlineAllocator<8>> FeatherColors;
+    for (int32 LayerIndex = 0; LayerIndex < ResolvedLayers.Num(); ++LayerIndex)
+    {
+        const FLinearColor LayerColor = (Layers.Num() > 0 ? Layers[LayerIndex].Color : ColorAttr.Get()) * Tint;
+        OpaqueColors.Add(LayerColor.ToFColor(true));
+        FeatherColors.Add(LayerColor.CopyWithNewOpacity(0.f).ToFColor(true));
+    }
+
+    const FSlateRenderTransform Xform = Geo.ToPaintGeometry().GetAccumulatedRenderTransform();
+
+    PaintVertices.SetNumUninitialized(CachedPoints.Num(), EAllowShrinking::No);
+    for (int32 Index = 0; Index < CachedPoints.Num(); ++Index)
+    {
+        const int32 LayerIndex = CachedPointLayers[Index];
+        const FColor& Col = CachedPointOpaque[Index] ? OpaqueColors[LayerIndex] : FeatherColors[LayerIndex];
+        PaintVertices[Index] = FSlateVertex::Make(Xform, CachedPoints[Index], FVector2f(0.f, 0.f), Col);
+    }
+
+    if (!WhiteBrushHandle.IsValid())
+    {
+        const FSlateBrush* White = FCoreStyle::Get().GetBrush("WhiteBrush");
+        WhiteBrushHandle = FSlateApplication::Get().GetRenderer()->GetResourceHandle(*White);
+    }
+
+    // Every ring goes out in one vertex/index buffer; triangles are ordered outer to inner so blending matches nesting.
+    FSlateDrawElement::MakeCustomVerts(Out, LayerId, WhiteBrushHandle, PaintVertices, CachedIndices, nullptr, 0, 0);
+
+    return SCompoundWidget::OnPaint(Args, Geo, CullingRect, Out, LayerId + 1, Style, bParentEnabled);
+}
+
+void SBeveledBorder::ResolveLayers(const FVector2f& LocalSize, FResolvedLayerArray& OutLayers) const
+{
+    auto Resolve = [&LocalSize](const FMargin& Inset, float Bevel, float NotchDepth, float NotchHeight, float Feather)
+    {
+        FResolvedLayer Layer;
+        Layer.Offset = FVector2f(Inset.Left, Inset.Top);
+        Layer.Size = FVector2f(
+            FMath::Max(0.f, LocalSize.X - Inset.Left - Inset.Right),
+            FMath::Max(0.f, LocalSize.Y - Inset.Top - Inset.Bottom));
+        Layer.Bevel = FMath::Clamp(Bevel, 0.f, 0.5f * FMath::Min(Layer.Size.X, Layer.Size.Y));
+        Layer.NotchDepth = FMath::Max(0.f, NotchDepth);
+        Layer.NotchHeight = FMath::Max(0.f, NotchHeight);
+        Layer.Feather = FMath::Max(0.f, Feather);
+        return Layer;
+    };
+
+    if (Layers.Num() == 0)
+    {
+        OutLayers.Add(Resolve(FMargin(0.f), BevelAttr.Get(), NotchDepthAttr.Get(), NotchHeightAttr.Get(), 0.f));
+        return;
+    }
+
+    for (const FBeveledBorderLayer& Layer : Layers)
+    {
+        OutLayers.Add(Resolve(Layer.Inset, Layer.Bevel, Layer.NotchDepth, Layer.NotchHeight, Layer.Feather));
+    }
+}
+
+bool SBeveledBorder::IsMeshCacheValid(const FResolvedLayerArray& InLayers, int32 RightCount, int32 LeftCount) const
+{
+    if (CachedRightNotchCount != RightCount || CachedLeftNotchCount != LeftCount || CachedLayers.Num() != InLayers.Num())
+    {
+        return false;
+    }
+
+    for (int32 Index = 0; Index < InLayers.Num(); ++Index)
+    {
+        if (!(CachedLayers[Index] == InLayers[Index]))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void SBeveledBorder::TessellateLayers(const FResolvedLayerArray& InLayers, int32 RightCount, int32 LeftCount) const
+{
+    CachedLayers.Reset();
+    CachedLayers.Append(InLayers);
+    CachedRightNotchCount = RightCount;
+    CachedLeftNotchCount = LeftCount;
+
+    CachedPoints.Reset();
+    CachedPointLayers.Reset();
+    CachedPointOpaque.Reset();
+    CachedIndices.Reset();
+
+    for (int32 LayerIndex = 0; LayerIndex < InLayers.Num() && LayerIndex <= MAX_uint8; ++LayerIndex)
+    {
+        TessellateLayer(LayerIndex, InLayers[LayerIndex], RightCount, LeftCount);
+    }
+}
+
+void SBeveledBorder::TessellateLayer(int32 LayerIndex, const FResolvedLayer& Layer, int32 RightCount, int32 LeftCount) const
+{
+    const float W = Layer.Size.X, H = Layer.Size.Y;
+    if (W <= KINDA_SMALL_NUMBER || H <= KINDA_SMALL_NUMBER)
+    {
+        return;
+    }
+
+    const float B  = Layer.Bevel;
+    const float ND = Layer.NotchDepth;
+    const float NH = Layer.NotchHeight;
+
+    // Matches the single-layer fallback: a ring without a usable bevel or notch is drawn as a plain rectangle.
+    const bool bHasNotches = B > 0.5f && ND > 0.5f && NH > 0.5f;
+    const float EffectiveBevel = bHasNotches ? B : 0.f;
+
+    const float AvailableHeight = FMath::Max(0.f, H - (2.f * EffectiveBevel));
+    const float ClampedND = FMath::Clamp(ND, 0.f, FMath::Max(0.f, (W * 0.5f) - EffectiveBevel));
 
     struct FNotchLayout
     {
@@ -58,117 +188,161 @@ int32 SBeveledBorder::OnPaint(
 
     auto CalcLayout = [&](int32 InCount) -> FNotchLayout
     {
-        FNotchLayout Layout;
-        const int32 Count = FMath::Max(0, InCount);
+        FNotchLayout NotchLayout;
+        const int32 Count = bHasNotches ? FMath::Max(0, InCount) : 0;
         if (Count <= 0 || AvailableHeight <= KINDA_SMALL_NUMBER)
         {
-            return Layout;
+            return NotchLayout;
         }
 
         const float TargetHeight = FMath::Max(0.f, NH);
         if (TargetHeight <= KINDA_SMALL_NUMBER)
         {
-            return Layout;
+            return NotchLayout;
         }
 
         const float MaxHeightPerNotch = AvailableHeight / static_cast<float>(Count);
         const float NotchHeight = FMath::Min(TargetHeight, MaxHeightPerNotch);
         if (NotchHeight <= KINDA_SMALL_NUMBER)
         {
-            return Layout;
+            return NotchLayout;
         }
 
         const float Spacing = FMath::Max(0.f, (AvailableHeight - (NotchHeight * Count)) / static_cast<float>(Count + 1));
 
-        Layout.Count = Count;
-        Layout.Height = NotchHeight;
-        Layout.Spacing = Spacing;
-        return Layout;
+        NotchLayout.Count = Count;
+        NotchLayout.Height = NotchHeight;
+        NotchLayout.Spacing = Spacing;
+        return NotchLayout;
     };
 
-    const FNotchLayout RightLayout = CalcLayout(RightNotchCountAttr.Get());
-    const FNotchLayout LeftLayout  = CalcLayout(LeftNotchCountAttr.Get());
+    const FNotchLayout RightLayout = CalcLayout(RightCount);
+    const FNotchLayout LeftLayout  = CalcLayout(LeftCount);
 
-    TArray<FVector2D> Outline;
-    Outline.Reserve(12 + (RightLayout.Count + LeftLayout.Count) * 3);
+    TArray<FVector2f>& Outline = ScratchOutline;
+    Outline.Reset();
 
+    const FVector2f Origin = Layer.Offset;
     auto AddPoint = [&](float X, float Y)
     {
-        const FVector2D Candidate(X, Y);
+        const FVector2f Candidate = Origin + FVector2f(X, Y);
         if (Outline.Num() == 0 || !Outline.Last().Equals(Candidate, KINDA_SMALL_NUMBER))
         {
             Outline.Add(Candidate);
         }
     };
 
-    AddPoint(B, 0.f);
-    AddPoint(W - B, 0.f);
-    AddPoint(W, B);
+    const float Bv = EffectiveBevel;
 
-    if (RightLayout.Count > 0)
+    AddPoint(Bv, 0.f);
+    AddPoint(W - Bv, 0.f);
+    AddPoint(W, Bv);
+
+    for (int32 Index = 0; Index < RightLayout.Count; ++Index)
     {
-        for (int32 Index = 0; Index < RightLayout.Count; ++Index)
-        {
-            const float Top = B + (RightLayout.Spacing * (Index + 1)) + (RightLayout.Height * Index);
-            const float Bottom = Top + RightLayout.Height;
-            const float Mid = Top + (RightLayout.Height * 0.5f);
+        const float Top = Bv + (RightLayout.Spacing * (Index + 1)) + (RightLayout.Height * Index);
+        const float Bottom = Top + RightLayout.Height;
+        const float Mid = Top + (RightLayout.Height * 0.5f);
 
-            AddPoint(W, Top);
-            AddPoint(W - ClampedND, Mid);
-            AddPoint(W, Bottom);
-        }
+        AddPoint(W, Top);
+        AddPoint(W - ClampedND, Mid);
+        AddPoint(W, Bottom);
     }
 
-    AddPoint(W, H - B);
-    AddPoint(W - B, H);
-    AddPoint(B, H);
-    AddPoint(0.f, H - B);
+    AddPoint(W, H - Bv);
+    AddPoint(W - Bv, H);
+    AddPoint(Bv, H);
+    AddPoint(0.f, H - Bv);
 
-    if (LeftLayout.Count > 0)
+    for (int32 Index = LeftLayout.Count - 1; Index >= 0; --Index)
     {
-        for (int32 Index = LeftLayout.Count - 1; Index >= 0; --Index)
-        {
-            const float Top = B + (LeftLayout.Spacing * (Index + 1)) + (LeftLayout.Height * Index);
-            const float Bottom = Top + LeftLayout.Height;
-            const float Mid = Top + (LeftLayout.Height * 0.5f);
+        const float Top = Bv + (LeftLayout.Spacing * (Index + 1)) + (LeftLayout.Height * Index);
+        const float Bottom = Top + LeftLayout.Height;
+        const float Mid = Top + (LeftLayout.Height * 0.5f);
 
-            AddPoint(0.f, Bottom);
-            AddPoint(ClampedND, Mid);
-            AddPoint(0.f, Top);
-        }
+        AddPoint(0.f, Bottom);
+        AddPoint(ClampedND, Mid);
+        AddPoint(0.f, Top);
     }
 
-    AddPoint(0.f, B);
+    AddPoint(0.f, Bv);
 
-    const FColor Col = LinCol.ToFColor(true);
-    const FSlateRenderTransform Xform = Geo.ToPaintGeometry().GetAccumulatedRenderTransform();
+    if (Outline.Num() > 1 && Outline.Last().Equals(Outline[0], KINDA_SMALL_NUMBER))
+    {
+        Outline.Pop(EAllowShrinking::No);
+    }
 
-    TArray<FSlateVertex> Verts;
-    TArray<SlateIndex> Indices;
+    const int32 OutlineCount = Outline.Num();
+    if (OutlineCount < 3)
+    {
+        return;
+    }
 
-    Verts.Reserve(Outline.Num() + 1);
-    Indices.Reserve(Outline.Num() * 3);
+    const uint8 LayerTag = static_cast<uint8>(LayerIndex);
+    const int32 Base = CachedPoints.Num();
 
-    for (const FVector2D& P : Outline)
+    for (const FVector2f& Point : Outline)
     {
-        Verts.Add(FSlateVertex::Make(Xform, FVector2f(P), FVector2f(0.f, 0.f), Col));
+        CachedPoints.Add(Point);
+        CachedPointLayers.Add(LayerTag);
+        CachedPointOpaque.Add(1);
     }
 
-    const int32 CenterIndex = Verts.Num();
-    Verts.Add(FSlateVertex::Make(Xform, FVector2f(Geo.GetLocalSize() * 0.5f), FVector2f(0.f, 0.f), Col));
+    const int32 CenterIndex = CachedPoints.Num();
+    CachedPoints.Add(Origin + (Layer.Size * 0.5f));
+    CachedPointLayers.Add(LayerTag);
+    CachedPointOpaque.Add(1);
 
-    for (int32 i = 0; i < CenterIndex; ++i)
+    for (int32 i = 0; i < OutlineCount; ++i)
     {
-        const int32 a = i;
-        const int32 b = (i + 1) % CenterIndex;
-        Indices.Add(CenterIndex);
-        Indices.Add(a);
-        Indices.Add(b);
+        CachedIndices.Add(CenterIndex);
+        CachedIndices.Add(Base + i);
+        CachedIndices.Add(Base + ((i + 1) % OutlineCount));
     }
 
-    const FSlateBrush* White = FCoreStyle::Get().GetBrush("WhiteBrush");
-    FSlateResourceHandle Handle = FSlateApplication::Get().GetRenderer()->GetResourceHandle(*White);
-    FSlateDrawElement::MakeCustomVerts(Out, LayerId, Handle, Verts, Indices, nullptr, 0, 0);
+    if (Layer.Feather <= KINDA_SMALL_NUMBER)
+    {
+        return;
+    }
 
-    return SCompoundWidget::OnPaint(Args, Geo, CullingRect, Out, LayerId + 1, Style, bParentEnabled);
+    // Feather: a strip pushed outwards along the vertex normals that fades to zero alpha.
+    // The outline is clockwise in Slate's y-down space, so (dy, -dx) of an edge points outside.
+    const int32 FeatherBase = CachedPoints.Num();
+    for (int32 i = 0; i < OutlineCount; ++i)
+    {
+        const FVector2f& Prev = Outline[(i + OutlineCount - 1) % OutlineCount];
+        const FVector2f& Curr = Outline[i];
+        const FVector2f& Next = Outline[(i + 1) % OutlineCount];
+
+        const FVector2f InEdge = Curr - Prev;
+        const FVector2f OutEdge = Next - Curr;
+        const FVector2f InNormal = FVector2f(InEdge.Y, -InEdge.X).GetSafeNormal();
+        const FVector2f OutNormal = FVector2f(OutEdge.Y, -OutEdge.X).GetSafeNormal();
+
+        FVector2f Normal = (InNormal + OutNormal).GetSafeNormal();
+        if (Normal.IsNearlyZero())
+        {
+            Normal = OutNormal;
+        }
+
+        // Keep the fringe width roughly constant at corners without letting sharp notches spike.
+        const float Miter = 1.f / FMath::Max(FVector2f::DotProduct(Normal, OutNormal), 0.5f);
+
+        CachedPoints.Add(Curr + Normal * (Layer.Feather * Miter));
+        CachedPointLayers.Add(LayerTag);
+        CachedPointOpaque.Add(0);
+    }
+
+    for (int32 i = 0; i < OutlineCount; ++i)
+    {
+        const int32 Next = (i + 1) % OutlineCount;
+
+        CachedIndices.Add(Base + i);
+        CachedIndices.Add(Base + Next);
+        CachedIndices.Add(FeatherBase + i);
+
+        CachedIndices.Add(Base + Next);
+        CachedIndices.Add(FeatherBase + Next);
+        CachedIndices.Add(FeatherBase + i);
+    }
 }
@@ -2,6 +2,8 @@
 
 #include "UI/Style/LunaraTeomSlateWidgetStyle.h"
 #include "UI/Widget/SBeveledBorder.h"
+#include "UI/Widget/ButtonLabelWidthCache.h"
+#include "UI/Widget/IconBrushCache.h"
 #include "UI/Widget/Button/IconText/SIconTextButtonWidget.h"
 
 #include "SlateOptMacros.h"
@@ -12,8 +14,6 @@
 #include "Brushes/SlateRoundedBoxBrush.h"
 
 #include "Widgets/Images/SImage.h"
-#include "Fonts/FontMeasure.h"
-#include "Rendering/SlateRenderer.h"
 #include "Widgets/Layout/SBackgroundBlur.h"
 #include "Widgets/Layout/SBorder.h"
 #include "Widgets/Layout/SBox.h"
@@ -22,18 +22,9 @@
 #include "Widgets/SOverlay.h"
 #include "Widgets/Text/STextBlock.h"
 
-#include "Engine/Texture2D.h"
-#include "Slate/SlateVectorArtData.h"
-
-#if __has_include("SVGImporter/Public/SVGData.h")
-#define WITH_SVG_IMPORTER 1
-#include "SVGImporter/Public/SVGData.h"
-#else
-#define WITH_SVG_IMPORTER 0
-#endif
-
 #include "Framework/Application/SlateApplication.h"
 #include "InputCoreTypes.h"
+#include "Algo/BinarySearch.h"
 
 namespace ListBuildingContainerWidgetPrivate
 {
@@ -43,6 +34,45 @@ namespace ListBuildingContainerWidgetPrivate
         FLinearColor::White,
         FVector4(22.f, 22.f, 6.f, 6.f)
     );
+
+    /** Pass-through wrapper that reports its arranged size, so the list can relayout on resize without ticking. */
+    class SArrangedSizeObserver : public SCompoundWidget
+    {
+    public:
+        DECLARE_DELEGATE_OneParam(FOnArrangedSizeChanged, const FVector2D&);
+
+        SLATE_BEGIN_ARGS(SArrangedSizeObserver)
+        {}
+            SLATE_DEFAULT_SLOT(FArguments, Content)
+            SLATE_EVENT(FOnArrangedSizeChanged, OnArrangedSizeChanged)
+        SLATE_END_ARGS()
+
+        void Construct(const FArguments& InArgs)
+        {
+            OnArrangedSizeChanged = InArgs._OnArrangedSizeChanged;
+
+            ChildSlot
+            [
+                InArgs._Content.Widget
+            ];
+        }
+
+        virtual void OnArrangeChildren(const FGeometry& AllottedGeometry, FArrangedChildren& ArrangedChildren) const override
+        {
+            SCompoundWidget::OnArrangeChildren(AllottedGeometry, ArrangedChildren);
+
+            const FVector2D LocalSize = AllottedGeometry.GetLocalSize();
+            if (!LocalSize.IsNearlyZero() && !LocalSize.Equals(LastArrangedSize, 0.5f))
+            {
+                LastArrangedSize = LocalSize;
+                OnArrangedSizeChanged.ExecuteIfBound(LocalSize);
+            }
+        }
+
+    private:
+        FOnArrangedSizeChanged OnArrangedSizeChanged;
+        mutable FVector2D LastArrangedSize = FVector2D::ZeroVector;
+    };
 }
 
 BEGIN_SLATE_FUNCTION_BUILD_OPTIMIZATION
@@ -51,8 +81,13 @@ void SListBuildingContainerWidget::Construct(const FArguments& InArgs)
     const FLunaraTeomSlateStyle& Style = FLunaraTeomSlateStyle::GetDefault();
 
     ButtonLabelFont = Style.CinzelRegular;
-    SetCanTick(true);
+    bVirtualizationEnabled = InArgs._EnableVirtualization;
+    VirtualizationOverscan = FMath::Max(0, InArgs._VirtualizationOverscan);
+    SetCanTick(false);
 
+    // The spacers live for the widget's lifetime; scrolling only changes their widths.
+    LeadingSpacer = SNew(SBox);
+    TrailingSpacer = SNew(SBox);
 
     const FLinearColor OuterBorderColor = Style.AccentColor.CopyWithNewOpacity(0.32f);
 
@@ -82,23 +117,28 @@ void SListBuildingContainerWidget::Construct(const FArguments& InArgs)
         .HAlign(HAlign_Fill)
         .Padding(FMargin(0.f, 8.f, 0.f, 0.f))
         [
-            SAssignNew(ScrollInteractionLayer, SBorder)
-            .Padding(FMargin(0.f))
-            .BorderImage(FCoreStyle::Get().GetBrush("NoBrush"))
-            .OnMouseButtonDown(this, &SListBuildingContainerWidget::HandleScrollAreaMouseButtonDown)
-            .OnMouseButtonUp(this, &SListBuildingContainerWidget::HandleScrollAreaMouseButtonUp)
-            .OnMouseMove(this, &SListBuildingContainerWidget::HandleScrollAreaMouseMove)
+            SNew(ListBuildingContainerWidgetPrivate::SArrangedSizeObserver)
+            .OnArrangedSizeChanged(this, &SListBuildingContainerWidget::HandleScrollAreaResized)
             [
-                SAssignNew(ButtonScrollBox, SScrollBox)
-                .Orientation(EOrientation::Orient_Horizontal)
-                .ScrollBarVisibility(EVisibility::Collapsed)
-                .AllowOverscroll(EAllowOverscroll::No)
-                .ConsumeMouseWheel(EConsumeMouseWheel::WhenScrollingPossible)
-                .AnimateWheelScrolling(true)
-                .Clipping(EWidgetClipping::ClipToBounds)
-                + SScrollBox::Slot()
+                SAssignNew(ScrollInteractionLayer, SBorder)
+                .Padding(FMargin(0.f))
+                .BorderImage(FCoreStyle::Get().GetBrush("NoBrush"))
+                .OnMouseButtonDown(this, &SListBuildingContainerWidget::HandleScrollAreaMouseButtonDown)
+                .OnMouseButtonUp(this, &SListBuildingContainerWidget::HandleScrollAreaMouseButtonUp)
+                .OnMouseMove(this, &SListBuildingContainerWidget::HandleScrollAreaMouseMove)
                 [
-                    SAssignNew(ButtonListContainer, SHorizontalBox)
+                    SAssignNew(ButtonScrollBox, SScrollBox)
+                    .Orientation(EOrientation::Orient_Horizontal)
+                    .ScrollBarVisibility(EVisibility::Collapsed)
+                    .AllowOverscroll(EAllowOverscroll::No)
+                    .ConsumeMouseWheel(EConsumeMouseWheel::WhenScrollingPossible)
+                    .AnimateWheelScrolling(true)
+                    .Clipping(EWidgetClipping::ClipToBounds)
+                    .OnUserScrolled(this, &SListBuildingContainerWidget::HandleButtonListScrolled)
+                    + SScrollBox::Slot()
+                    [
+                        SAssignNew(ButtonListContainer, SHorizontalBox)
+                    ]
                 ]
             ]
         ];
@@ -142,12 +182,23 @@ void SListBuildingContainerWidget::Construct(const FArguments& InArgs)
             ]
         ];
 
-    SAssignNew(ContentBorder, SBeveledBorder)
-        .Bevel(6.f)
-        .NotchDepth(4.f)
-        .NotchHeight(10.f)
-        .Color(GlassBaseColor)
-        .Padding(FMargin(10.f, 10.f, 10.f, 14.f))
+    // Outer frame, rim highlight, inner keyline and glass base share one widget and one draw element.
+    // Insets reproduce the former nesting: 4px frame padding, 1.5px/2px overlay slots and a 6px inner padding.
+    constexpr float FrameFeather = 1.f;
+    TArray<FBeveledBorderLayer> FrameLayers;
+    FrameLayers.Reserve(4);
+    FrameLayers.Emplace(FMargin(0.f),                         10.f, 8.f, 18.f, OuterBorderColor,    FrameFeather);
+    FrameLayers.Emplace(FMargin(4.f) + OuterBorderRimPadding, 9.f,  7.f, 16.f, OuterBorderRimColor, FrameFeather);
+    FrameLayers.Emplace(FMargin(6.f),                         8.f,  6.f, 14.f, InnerBorderColor,    FrameFeather);
+    FrameLayers.Emplace(FMargin(12.f),                        6.f,  4.f, 10.f, GlassBaseColor,      FrameFeather);
+
+    ChildSlot
+    [
+        SAssignNew(ContentBorder, SBeveledBorder)
+        .Layers(MoveTemp(FrameLayers))
+        .RightNotchCount(1)
+        .LeftNotchCount(1)
+        .Padding(FMargin(22.f, 22.f, 22.f, 26.f))
         [
             SNew(SBackgroundBlur)
             .BlurStrength(18.f)
@@ -158,46 +209,6 @@ void SListBuildingContainerWidget::Construct(const FArguments& InArgs)
             [
                 GlassSurface
             ]
-        ];
-
-    ChildSlot
-    [
-        SNew(SBeveledBorder)
-        .Bevel(10.f)
-        .NotchDepth(8.f)
-        .NotchHeight(18.f)
-        .RightNotchCount(1)
-        .LeftNotchCount(1)
-        .Color(OuterBorderColor)
-        .Padding(FMargin(4.f))
-        [
-            SNew(SOverlay)
-            + SOverlay::Slot()
-            .Padding(OuterBorderRimPadding)
-            [
-                SNew(SBeveledBorder)
-                .Bevel(9.f)
-                .NotchDepth(7.f)
-                .NotchHeight(16.f)
-                .RightNotchCount(1)
-                .LeftNotchCount(1)
-                .Color(OuterBorderRimColor)
-            ]
-            + SOverlay::Slot()
-            .Padding(FMargin(2.f))
-            [
-                SNew(SBeveledBorder)
-                .Bevel(8.f)
-                .NotchDepth(6.f)
-                .NotchHeight(14.f)
-                .RightNotchCount(1)
-                .LeftNotchCount(1)
-                .Color(InnerBorderColor)
-                .Padding(FMargin(6.f))
-                [
-                    ContentBorder.ToSharedRef()
-                ]
-            ]
         ]
     ];
 
@@ -242,10 +253,288 @@ void SListBuildingContainerWidget::ClearContent()
 
 void SListBuildingContainerWidget::SetButtonItems(const TArray<FListBuildingButtonItem>& InItems)
 {
+    if (!ButtonListContainer.IsValid() || ButtonSlotLayouts.Num() != ButtonItems.Num())
+    {
+        ButtonItems = InItems;
+        RebuildButtonList();
+        return;
+    }
+
+    // Trim the unchanged head and tail so a single insert, removal or edit only touches the affected slots.
+    const int32 OldCount = ButtonItems.Num();
+    const int32 NewCount = InItems.Num();
+
+    int32 Prefix = 0;
+    while (Prefix < OldCount && Prefix < NewCount && ButtonItems[Prefix] == InItems[Prefix])
+    {
+        ++Prefix;
+    }
+
+    int32 Suffix = 0;
+    while (Suffix < OldCount - Prefix && Suffix < NewCount - Prefix
+        && ButtonItems[OldCount - 1 - Suffix] == InItems[NewCount - 1 - Suffix])
+    {
+        ++Suffix;
+    }
+
+    const int32 OldChanged = OldCount - Prefix - Suffix;
+    const int32 NewChanged = NewCount - Prefix - Suffix;
+
+    if (OldChanged == 0 && NewChanged == 0)
+    {
+        return;
+    }
+
+    if (OldChanged == NewChanged)
+    {
+        UpdateButtonItems(Prefix, MakeArrayView(InItems).Slice(Prefix, NewChanged));
+        return;
+    }
+
+    if (OldChanged == 0 && NewChanged == 1)
+    {
+        InsertButtonItem(Prefix, InItems[Prefix]);
+        return;
+    }
+
+    if (OldChanged == 1 && NewChanged == 0)
+    {
+        RemoveButtonItemAt(Prefix);
+        return;
+    }
+
     ButtonItems = InItems;
     RebuildButtonList();
 }
 
+void SListBuildingContainerWidget::InsertButtonItem(int32 Index, const FListBuildingButtonItem& InItem)
+{
+    const int32 InsertIndex = FMath::Clamp(Index, 0, ButtonItems.Num());
+    ButtonItems.Insert(InItem, InsertIndex);
+
+    if (!CanApplyIncrementalChange(ButtonItems.Num() - 1))
+    {
+        RebuildButtonList();
+        return;
+    }
+
+    ButtonIconBrushes.Insert(TSharedPtr<FSlateBrush>(), InsertIndex);
+    ButtonSlotLayouts.Insert(ComputeSlotLayout(InsertIndex, CachedListMetrics), InsertIndex);
+
+    for (FRealizedButton& Realized : RealizedButtons)
+    {
+        if (Realized.ItemIndex >= InsertIndex)
+        {
+            ++Realized.ItemIndex;
+        }
+    }
+
+    if (!bVirtualizationEnabled)
+    {
+        FRealizedButton& Inserted = RealizedButtons.InsertDefaulted_GetRef(InsertIndex);
+        BindRealizedButton(Inserted, InsertIndex);
+
+        ButtonListContainer->InsertSlot(InsertIndex)
+        .AutoWidth()
+        .HAlign(HAlign_Center)
+        [
+            Inserted.SizeBox.ToSharedRef()
+        ];
+    }
+
+    ApplyIncrementalChange();
+}
+
+void SListBuildingContainerWidget::UpdateButtonItem(int32 Index, const FListBuildingButtonItem& InItem)
+{
+    if (!ButtonItems.IsValidIndex(Index))
+    {
+        return;
+    }
+
+    UpdateButtonItems(Index, MakeArrayView(&InItem, 1));
+}
+
+void SListBuildingContainerWidget::UpdateButtonItems(int32 FirstIndex, TConstArrayView<FListBuildingButtonItem> InItems)
+{
+    // Apply every data change first and lay the list out once, so re-sorting or re-filtering a whole
+    // catalog stays linear instead of paying a full padding pass per changed item.
+    TBitArray<> ChangedItems(false, InItems.Num());
+    bool bAnyChanged = false;
+
+    for (int32 Offset = 0; Offset < InItems.Num(); ++Offset)
+    {
+        FListBuildingButtonItem& Item = ButtonItems[FirstIndex + Offset];
+        if (!(Item == InItems[Offset]))
+        {
+            Item = InItems[Offset];
+            ChangedItems[Offset] = true;
+            bAnyChanged = true;
+        }
+    }
+
+    if (!bAnyChanged)
+    {
+        return;
+    }
+
+    if (!CanApplyIncrementalChange(ButtonItems.Num()))
+    {
+        RebuildButtonList();
+        return;
+    }
+
+    for (TConstSetBitIterator<> It(ChangedItems); It; ++It)
+    {
+        const int32 Index = FirstIndex + It.GetIndex();
+        ButtonIconBrushes[Index].Reset();
+
+        const FMargin PreservedPadding = ButtonSlotLayouts[Index].Padding;
+        ButtonSlotLayouts[Index] = ComputeSlotLayout(Index, CachedListMetrics);
+        ButtonSlotLayouts[Index].Padding = PreservedPadding;
+    }
+
+    for (FRealizedButton& Realized : RealizedButtons)
+    {
+        const int32 Offset = Realized.ItemIndex - FirstIndex;
+        if (!ChangedItems.IsValidIndex(Offset) || !ChangedItems[Offset])
+        {
+            continue;
+        }
+
+        const int32 Index = Realized.ItemIndex;
+        Realized.ItemIndex = INDEX_NONE;
+        if (!bVirtualizationEnabled)
+        {
+            BindRealizedButton(Realized, Index);
+        }
+    }
+
+    ApplyIncrementalChange();
+}
+
+void SListBuildingContainerWidget::RemoveButtonItemAt(int32 Index)
+{
+    if (!ButtonItems.IsValidIndex(Index))
+    {
+        return;
+    }
+
+    ButtonItems.RemoveAt(Index);
+
+    if (!CanApplyIncrementalChange(ButtonItems.Num() + 1))
+    {
+        RebuildButtonList();
+        return;
+    }
+
+    ButtonIconBrushes.RemoveAt(Index);
+    ButtonSlotLayouts.RemoveAt(Index);
+
+    if (!bVirtualizationEnabled)
+    {
+        const FRealizedButton Removed = RealizedButtons[Index];
+        RealizedButtons.RemoveAt(Index);
+
+        if (Removed.SizeBox.IsValid())
+        {
+            ButtonListContainer->RemoveSlot(Removed.SizeBox.ToSharedRef());
+        }
+    }
+
+    for (FRealizedButton& Realized : RealizedButtons)
+    {
+        if (Realized.ItemIndex == Index)
+        {
+            Realized.ItemIndex = INDEX_NONE;
+        }
+        else if (Realized.ItemIndex > Index)
+        {
+            --Realized.ItemIndex;
+        }
+    }
+
+    ApplyIncrementalChange();
+}
+
+void SListBuildingContainerWidget::MoveButtonItem(int32 FromIndex, int32 ToIndex)
+{
+    if (!ButtonItems.IsValidIndex(FromIndex) || !ButtonItems.IsValidIndex(ToIndex) || FromIndex == ToIndex)
+    {
+        return;
+    }
+
+    FListBuildingButtonItem MovedItem = MoveTemp(ButtonItems[FromIndex]);
+    ButtonItems.RemoveAt(FromIndex);
+    ButtonItems.Insert(MoveTemp(MovedItem), ToIndex);
+
+    if (!CanApplyIncrementalChange(ButtonItems.Num()))
+    {
+        RebuildButtonList();
+        return;
+    }
+
+    TSharedPtr<FSlateBrush> MovedBrush = ButtonIconBrushes[FromIndex];
+    ButtonIconBrushes.RemoveAt(FromIndex);
+    ButtonIconBrushes.Insert(MovedBrush, ToIndex);
+
+    const FButtonSlotLayout MovedLayout = ButtonSlotLayouts[FromIndex];
+    ButtonSlotLayouts.RemoveAt(FromIndex);
+    ButtonSlotLayouts.Insert(MovedLayout, ToIndex);
+
+    if (bVirtualizationEnabled)
+    {
+        for (FRealizedButton& Realized : RealizedButtons)
+        {
+            if (Realized.ItemIndex == FromIndex)
+            {
+                Realized.ItemIndex = ToIndex;
+            }
+            else if (FromIndex < ToIndex && Realized.ItemIndex > FromIndex && Realized.ItemIndex <= ToIndex)
+            {
+                --Realized.ItemIndex;
+            }
+            else if (ToIndex < FromIndex && Realized.ItemIndex >= ToIndex && Realized.ItemIndex < FromIndex)
+            {
+                ++Realized.ItemIndex;
+            }
+        }
+    }
+    else
+    {
+        const FRealizedButton Moved = RealizedButtons[FromIndex];
+        RealizedButtons.RemoveAt(FromIndex);
+        RealizedButtons.Insert(Moved, ToIndex);
+
+        for (int32 RealizedIndex = 0; RealizedIndex < RealizedButtons.Num(); ++RealizedIndex)
+        {
+            RealizedButtons[RealizedIndex].ItemIndex = RealizedIndex;
+        }
+
+        ButtonListContainer->RemoveSlot(Moved.SizeBox.ToSharedRef());
+        ButtonListContainer->InsertSlot(ToIndex)
+        .AutoWidth()
+        .HAlign(HAlign_Center)
+        [
+            Moved.SizeBox.ToSharedRef()
+        ];
+    }
+
+    ApplyIncrementalChange();
+}
+
+void SListBuildingContainerWidget::SetVirtualization(bool bInEnabled, int32 InOverscan)
+{
+    const int32 ClampedOverscan = FMath::Max(0, InOverscan);
+    if (bVirtualizationEnabled == bInEnabled && VirtualizationOverscan == ClampedOverscan)
+    {
+        return;
+    }
+
+    bVirtualizationEnabled = bInEnabled;
+    VirtualizationOverscan = ClampedOverscan;
+    RebuildButtonList();
+}
 
 void SListBuildingContainerWidget::SetButtonFont(const FSlateFontInfo& InFont)
 {
@@ -272,156 +561,471 @@ void SListBuildingContainerWidget::RebuildButtonList()
     }
 
     ButtonListContainer->ClearChildren();
+    ReleaseRealizedButtons();
+
     ButtonIconBrushes.Reset(ButtonItems.Num());
+    ButtonIconBrushes.SetNum(ButtonItems.Num());
+    ComputeButtonLayouts();
+
+    if (ButtonScrollBox.IsValid())
+    {
+        ButtonScrollBox->ScrollToStart();
+    }
+
+    if (ButtonItems.Num() <= 0)
+    {
+        return;
+    }
+
+    if (bVirtualizationEnabled)
+    {
+        RefreshVirtualizedWindow(true);
+        return;
+    }
+
+    RealizedButtons.SetNum(ButtonItems.Num());
+
+    for (int32 ItemIndex = 0; ItemIndex < ButtonItems.Num(); ++ItemIndex)
+    {
+        FRealizedButton& Realized = RealizedButtons[ItemIndex];
+        BindRealizedButton(Realized, ItemIndex);
+
+        ButtonListContainer->AddSlot()
+        .AutoWidth()
+        .Padding(ButtonSlotLayouts[ItemIndex].Padding)
+        .HAlign(HAlign_Center)
+        [
+            Realized.SizeBox.ToSharedRef()
+        ];
+    }
+
+    RealizedFirstIndex = 0;
+    RealizedLastIndex = ButtonItems.Num() - 1;
+}
+
+void SListBuildingContainerWidget::ComputeButtonLayouts()
+{
+    const int32 ItemCount = ButtonItems.Num();
+
+    CachedListMetrics = ComputeListMetrics(ItemCount);
+
+    ButtonSlotLayouts.Reset(ItemCount);
+    for (int32 ItemIndex = 0; ItemIndex < ItemCount; ++ItemIndex)
+    {
+        ButtonSlotLayouts.Add(ComputeSlotLayout(ItemIndex, CachedListMetrics));
+    }
+
+    UpdateSlotPaddingsAndOffsets();
+}
 
+SListBuildingContainerWidget::FButtonListMetrics SListBuildingContainerWidget::ComputeListMetrics(int32 ItemCount) const
+{
     constexpr float ButtonBaseExtent = 116.f;
     const float MinSlotSpacing = 20.f;
 
-    const TAttribute<FOptionalSize> ButtonExtentAttribute = TAttribute<FOptionalSize>::Create(TAttribute<FOptionalSize>::FGetter::CreateSP(this, &SListBuildingContainerWidget::GetButtonExtent));
+    FButtonListMetrics Metrics;
 
     const FOptionalSize ButtonExtentOptional = GetButtonExtent();
-    const float ButtonExtentValue = ButtonExtentOptional.IsSet() ? FMath::Max(1.f, ButtonExtentOptional.Get()) : ButtonBaseExtent;
+    Metrics.ButtonExtent = ButtonExtentOptional.IsSet() ? FMath::Max(1.f, ButtonExtentOptional.Get()) : ButtonBaseExtent;
+    Metrics.LabelSpacing = FMath::Clamp(Metrics.ButtonExtent * 0.08f, 4.f, 12.f);
+    Metrics.LabelHorizontalPadding = FMath::Max(8.f, Metrics.ButtonExtent * 0.12f);
+
     const float ContainerWidth = GetContainerWidth();
-    const float LabelReservedRatio = 0.35f;
-    const float DefaultLabelSpacing = FMath::Clamp(ButtonExtentValue * 0.08f, 4.f, 12.f);
-    const float LabelHorizontalPadding = FMath::Max(8.f, ButtonExtentValue * 0.12f);
 
-    float ComputedGap = MinSlotSpacing;
-    if (ButtonItems.Num() > 0 && ContainerWidth > KINDA_SMALL_NUMBER)
+    Metrics.Gap = MinSlotSpacing;
+    if (ItemCount > 0 && ContainerWidth > KINDA_SMALL_NUMBER)
     {
-        const float TotalButtonWidth = ButtonExtentValue * ButtonItems.Num();
+        const float TotalButtonWidth = Metrics.ButtonExtent * ItemCount;
         const float AvailableWidth = ContainerWidth - TotalButtonWidth;
         if (AvailableWidth > 0.f)
         {
-            const float SpaceAroundGap = AvailableWidth / static_cast<float>(ButtonItems.Num() + 1);
-            ComputedGap = FMath::Max(MinSlotSpacing, SpaceAroundGap);
+            const float SpaceAroundGap = AvailableWidth / static_cast<float>(ItemCount + 1);
+            Metrics.Gap = FMath::Max(MinSlotSpacing, SpaceAroundGap);
         }
     }
 
-    if (ButtonItems.Num() <= 0)
+    return Metrics;
+}
+
+SListBuildingContainerWidget::FButtonSlotLayout SListBuildingContainerWidget::ComputeSlotLayout(int32 ItemIndex, const FButtonListMetrics& Metrics) const
+{
+    const float LabelReservedRatio = 0.35f;
+
+    const FListBuildingButtonItem& Item = ButtonItems[ItemIndex];
+
+    const bool bHasIcon = ShouldDisplayIcon(Item.Icon);
+    const bool bHasLabel = !Item.Label.IsEmpty();
+
+    float LabelSpacing = 0.f;
+    float IconBoxSize = Metrics.ButtonExtent;
+    float LabelMeasuredWidth = 0.f;
+
+    if (bHasLabel)
     {
-        if (ButtonScrollBox.IsValid())
+        LabelSpacing = bHasIcon ? Metrics.LabelSpacing : 0.f;
+        const float ReservedHeight = Metrics.ButtonExtent * LabelReservedRatio;
+        const float AvailableForIcon = FMath::Max(0.f, Metrics.ButtonExtent - ReservedHeight - LabelSpacing);
+        IconBoxSize = FMath::Max(0.f, AvailableForIcon);
+
+        if (IconBoxSize <= KINDA_SMALL_NUMBER)
         {
-            ButtonScrollBox->ScrollToStart();
+            IconBoxSize = FMath::Max(0.f, Metrics.ButtonExtent - LabelSpacing);
         }
+
+        LabelMeasuredWidth = FButtonLabelWidthCache::Get().Measure(Item.Label, ButtonLabelFont);
+    }
+
+    FButtonSlotLayout Layout;
+    Layout.Width = FMath::Max(Metrics.ButtonExtent, LabelMeasuredWidth + Metrics.LabelHorizontalPadding);
+    Layout.IconSize = IconBoxSize;
+    Layout.LabelSpacing = LabelSpacing;
+    return Layout;
+}
+
+void SListBuildingContainerWidget::UpdateSlotPaddingsAndOffsets()
+{
+    const int32 ItemCount = ButtonSlotLayouts.Num();
+    const float FullGap = CachedListMetrics.Gap;
+    const float HalfGap = FullGap * 0.5f;
+
+    ButtonSlotOffsets.Reset(ItemCount + 1);
+    ButtonSlotOffsets.Add(0.f);
+
+    for (int32 ItemIndex = 0; ItemIndex < ItemCount; ++ItemIndex)
+    {
+        FButtonSlotLayout& Layout = ButtonSlotLayouts[ItemIndex];
+
+        const float LeftPadding = (ItemIndex == 0) ? FullGap : HalfGap;
+        const float RightPadding = (ItemIndex == ItemCount - 1) ? FullGap : HalfGap;
+        Layout.Padding = FMargin(LeftPadding, 0.f, RightPadding, 0.f);
+
+        ButtonSlotOffsets.Add(ButtonSlotOffsets.Last() + LeftPadding + Layout.Width + RightPadding);
+    }
+}
+
+bool SListBuildingContainerWidget::CanApplyIncrementalChange(int32 PreviousItemCount) const
+{
+    if (!ButtonListContainer.IsValid())
+    {
+        return false;
+    }
+
+    // Slot bookkeeping must describe the list as it was before this single-item change.
+    if (ButtonSlotLayouts.Num() != PreviousItemCount || ButtonIconBrushes.Num() != PreviousItemCount)
+    {
+        return false;
+    }
+
+    if (!bVirtualizationEnabled && RealizedButtons.Num() != PreviousItemCount)
+    {
+        return false;
+    }
+
+    // A different button extent changes every slot width, which needs a full rebuild.
+    return FMath::IsNearlyEqual(ComputeListMetrics(ButtonItems.Num()).ButtonExtent, CachedListMetrics.ButtonExtent);
+}
+
+void SListBuildingContainerWidget::ApplyIncrementalChange()
+{
+    if (ButtonItems.Num() <= 0)
+    {
+        RebuildButtonList();
         return;
     }
 
-    const float HalfGap = ComputedGap * 0.5f;
+    CachedListMetrics = ComputeListMetrics(ButtonItems.Num());
+    UpdateSlotPaddingsAndOffsets();
 
-    for (int32 ItemIndex = 0; ItemIndex < ButtonItems.Num(); ++ItemIndex)
+    if (bVirtualizationEnabled)
     {
-        const FListBuildingButtonItem& Item = ButtonItems[ItemIndex];
+        RefreshVirtualizedWindow(true);
+        return;
+    }
 
-        TSharedPtr<FSlateBrush> IconBrush;
-        if (ShouldDisplayIcon(Item.Icon))
-        {
-            IconBrush = MakeShared<FSlateBrush>(Item.Icon);
-            if (IconBrush->DrawAs == ESlateBrushDrawType::NoDrawType)
-            {
-                IconBrush->DrawAs = ESlateBrushDrawType::Image;
-            }
+    RealizedFirstIndex = ButtonItems.Num() > 0 ? 0 : INDEX_NONE;
+    RealizedLastIndex = ButtonItems.Num() - 1;
 
-            if (UObject* Resource = IconBrush->GetResourceObject())
-            {
-                if (USlateVectorArtData* VectorArt = Cast<USlateVectorArtData>(Resource))
-                {
-                    IconBrush->ImageType = ESlateBrushImageType::Vector;
-                    IconBrush->SetResourceObject(VectorArt);
-                }
-#if WITH_SVG_IMPORTER
-                else if (const USVGData* SVGData = Cast<USVGData>(Resource))
-                {
-                    if (UTexture2D* SVGTexture = SVGData->SVGTexture)
-                    {
-#if !UE_BUILD_SHIPPING
-                        UE_LOG(LogTemp, Verbose, TEXT("SListBuildingContainerWidget: Rebinding SVGData %s to texture %s"),
-                            *SVGData->GetName(),
-                            *SVGTexture->GetName());
-#endif
-                        IconBrush->SetResourceObject(SVGTexture);
-                        IconBrush->ImageType = ESlateBrushImageType::FullColor;
-                    }
-#if !UE_BUILD_SHIPPING
-                    else
-                    {
-                        UE_LOG(LogTemp, Warning, TEXT("SListBuildingContainerWidget: SVGData %s has no SVGTexture"), *SVGData->GetName());
-                    }
-#endif
-                }
-#endif
-            }
+    ApplySlotPaddings();
+}
+
+void SListBuildingContainerWidget::ApplySlotPaddings()
+{
+    if (!ButtonListContainer.IsValid() || bVirtualizationEnabled)
+    {
+        return;
+    }
+
+    for (int32 SlotIndex = 0; SlotIndex < ButtonListContainer->NumSlots() && ButtonSlotLayouts.IsValidIndex(SlotIndex); ++SlotIndex)
+    {
+        ButtonListContainer->GetSlot(SlotIndex).SetPadding(ButtonSlotLayouts[SlotIndex].Padding);
+    }
+}
+
+const FSlateBrush* SListBuildingContainerWidget::GetOrCreateIconBrush(int32 ItemIndex)
+{
+    if (!ButtonItems.IsValidIndex(ItemIndex) || !ButtonIconBrushes.IsValidIndex(ItemIndex))
+    {
+        return nullptr;
+    }
+
+    if (ButtonIconBrushes[ItemIndex].IsValid())
+    {
+        return ButtonIconBrushes[ItemIndex].Get();
+    }
+
+    const FListBuildingButtonItem& Item = ButtonItems[ItemIndex];
+    if (!ShouldDisplayIcon(Item.Icon))
+    {
+        return nullptr;
+    }
+
+    // Identical icons share one resolved brush across items, rebuilds and list instances.
+    TSharedPtr<FSlateBrush> IconBrush = FIconBrushCache::Get().Acquire(Item.Icon);
+
+    ButtonIconBrushes[ItemIndex] = IconBrush;
+    return IconBrush.Get();
+}
+
+TSharedRef<SBox> SListBuildingContainerWidget::MakeButtonSlotContent(int32 ItemIndex, TSharedPtr<SIconTextButtonWidget>& OutButton)
+{
+    const FListBuildingButtonItem& Item = ButtonItems[ItemIndex];
+    const FButtonSlotLayout& Layout = ButtonSlotLayouts[ItemIndex];
+
+    return SNew(SBox)
+        .WidthOverride(Layout.Width)
+        .HeightOverride(CachedListMetrics.ButtonExtent)
+        [
+            SAssignNew(OutButton, SIconTextButtonWidget)
+            .IconBrush(GetOrCreateIconBrush(ItemIndex))
+            .IconColor(FLinearColor::White)
+            .Label(Item.Label)
+            .Font(ButtonLabelFont)
+            .LabelColor(FSlateColor(FLinearColor::White))
+            .IconSize(Layout.IconSize)
+            .Spacing(Layout.LabelSpacing)
+            .LabelMaxWidth(Layout.Width)
+        ];
+}
+
+void SListBuildingContainerWidget::BindRealizedButton(FRealizedButton& Realized, int32 ItemIndex)
+{
+    if (!Realized.SizeBox.IsValid() || !Realized.Button.IsValid())
+    {
+        Realized.SizeBox = MakeButtonSlotContent(ItemIndex, Realized.Button);
+        Realized.ItemIndex = ItemIndex;
+        return;
+    }
+
+    if (Realized.ItemIndex == ItemIndex)
+    {
+        return;
+    }
+
+    Realized.ItemIndex = ItemIndex;
+    Realized.Button->SetIconBrush(GetOrCreateIconBrush(ItemIndex));
+    Realized.Button->SetLabel(ButtonItems[ItemIndex].Label);
+    Realized.Button->SetFont(ButtonLabelFont);
+    ApplySlotLayout(Realized);
+}
+
+void SListBuildingContainerWidget::ApplySlotLayout(FRealizedButton& Realized)
+{
+    const FButtonSlotLayout& Layout = ButtonSlotLayouts[Realized.ItemIndex];
+
+    Realized.SizeBox->SetWidthOverride(Layout.Width);
+    Realized.SizeBox->SetHeightOverride(CachedListMetrics.ButtonExtent);
+    Realized.Button->SetIconSize(Layout.IconSize);
+    Realized.Button->SetSpacing(Layout.LabelSpacing);
+    Realized.Button->SetLabelMaxWidth(Layout.Width);
+}
+
+void SListBuildingContainerWidget::RefreshVirtualizedWindow(bool bForce)
+{
+    const int32 ItemCount = ButtonItems.Num();
+    if (!bVirtualizationEnabled || !ButtonListContainer.IsValid() || ItemCount <= 0 || ButtonSlotLayouts.Num() != ItemCount)
+    {
+        return;
+    }
+
+    const float ScrollOffset = ButtonScrollBox.IsValid() ? ButtonScrollBox->GetScrollOffset() : 0.f;
+
+    // Before the first layout pass the viewport width is unknown; realize roughly one screen of buttons.
+    float ViewportWidth = GetContainerWidth();
+    if (ViewportWidth <= KINDA_SMALL_NUMBER)
+    {
+        ViewportWidth = ButtonSlotLayouts[0].Width * 8.f;
+    }
+
+    // ButtonSlotOffsets holds ItemCount + 1 ascending slot edges; the slot containing X starts at the last edge <= X.
+    auto FindSlotAt = [this, ItemCount](float X)
+    {
+        const int32 EdgeIndex = Algo::UpperBound(ButtonSlotOffsets, X) - 1;
+        return FMath::Clamp(EdgeIndex, 0, ItemCount - 1);
+    };
+
+    const int32 FirstIndex = FMath::Max(0, FindSlotAt(ScrollOffset) - VirtualizationOverscan);
+    const int32 LastIndex = FMath::Min(ItemCount - 1, FindSlotAt(ScrollOffset + ViewportWidth) + VirtualizationOverscan);
+
+    if (!bForce && FirstIndex == RealizedFirstIndex && LastIndex == RealizedLastIndex)
+    {
+        return;
+    }
+
+    // Spacers stand in for the unrealized buttons so the scroll extent matches the full list.
+    LeadingSpacer->SetWidthOverride(ButtonSlotOffsets[FirstIndex]);
+    TrailingSpacer->SetWidthOverride(FMath::Max(0.f, ButtonSlotOffsets.Last() - ButtonSlotOffsets[LastIndex + 1]));
+
+    // A scroll step only adds and removes the slots entering or leaving the window. A forced refresh
+    // (e.g. after an incremental edit) may have renumbered realized buttons, so it re-adds every slot.
+    const bool bSlotsInSync = RealizedFirstIndex != INDEX_NONE && ButtonListContainer->NumSlots() == RealizedButtons.Num() + 2;
+    if (bForce || !bSlotsInSync)
+    {
+        RebuildVirtualizedSlots(FirstIndex, LastIndex);
+    }
+    else
+    {
+        ShiftVirtualizedSlots(FirstIndex, LastIndex);
+    }
+
+    RealizedFirstIndex = FirstIndex;
+    RealizedLastIndex = LastIndex;
+}
+
+void SListBuildingContainerWidget::RebuildVirtualizedSlots(int32 FirstIndex, int32 LastIndex)
+{
+    // Keep widgets that are still inside the window bound to their item, recycle everything else.
+    TArray<FRealizedButton> NextRealized;
+    NextRealized.SetNum(LastIndex - FirstIndex + 1);
 
-            ButtonIconBrushes.Add(IconBrush);
+    for (FRealizedButton& Realized : RealizedButtons)
+    {
+        if (Realized.ItemIndex >= FirstIndex && Realized.ItemIndex <= LastIndex)
+        {
+            NextRealized[Realized.ItemIndex - FirstIndex] = MoveTemp(Realized);
         }
         else
         {
-            ButtonIconBrushes.Add(nullptr);
+            Realized.ItemIndex = INDEX_NONE;
+            RecycledButtons.Add(MoveTemp(Realized));
         }
+    }
 
-        const TSharedPtr<FSlateBrush>& StoredBrush = ButtonIconBrushes.Last();
-        const bool bHasIcon = StoredBrush.IsValid();
-        const bool bHasLabel = !Item.Label.IsEmpty();
+    for (int32 ItemIndex = FirstIndex; ItemIndex <= LastIndex; ++ItemIndex)
+    {
+        AcquireRealizedButton(NextRealized[ItemIndex - FirstIndex], ItemIndex);
+    }
 
-        float LabelSpacing = 0.f;
-        float IconBoxSize = ButtonExtentValue;
-        float LabelMeasuredWidth = 0.f;
+    RealizedButtons = MoveTemp(NextRealized);
 
-        if (bHasLabel)
-        {
-            LabelSpacing = bHasIcon ? DefaultLabelSpacing : 0.f;
-            const float ReservedHeight = ButtonExtentValue * LabelReservedRatio;
-            const float AvailableForIcon = FMath::Max(0.f, ButtonExtentValue - ReservedHeight - LabelSpacing);
-            IconBoxSize = FMath::Max(0.f, AvailableForIcon);
+    ButtonListContainer->ClearChildren();
 
-            if (IconBoxSize <= KINDA_SMALL_NUMBER)
-            {
-                IconBoxSize = FMath::Max(0.f, ButtonExtentValue - LabelSpacing);
-            }
+    ButtonListContainer->AddSlot()
+    .AutoWidth()
+    [
+        LeadingSpacer.ToSharedRef()
+    ];
 
-            if (FSlateApplication::IsInitialized())
-            {
-                if (FSlateRenderer* Renderer = FSlateApplication::Get().GetRenderer())
-                {
-                    const TSharedRef<FSlateFontMeasure> FontMeasure = Renderer->GetFontMeasureService();
-                    LabelMeasuredWidth = FontMeasure->Measure(Item.Label, ButtonLabelFont).X;
-                }
-            }
+    for (const FRealizedButton& Realized : RealizedButtons)
+    {
+        InsertVirtualizedSlot(ButtonListContainer->NumSlots(), Realized);
+    }
+
+    ButtonListContainer->AddSlot()
+    .AutoWidth()
+    [
+        TrailingSpacer.ToSharedRef()
+    ];
+}
+
+void SListBuildingContainerWidget::ShiftVirtualizedSlots(int32 FirstIndex, int32 LastIndex)
+{
+    // Items realized both before and after the step keep their slots untouched.
+    const int32 KeptFirst = FMath::Max(FirstIndex, RealizedFirstIndex);
+    const int32 KeptLast = FMath::Min(LastIndex, RealizedLastIndex);
+
+    TArray<FRealizedButton> NextRealized;
+    NextRealized.Reserve(LastIndex - FirstIndex + 1);
+
+    TArray<FRealizedButton> Kept;
+    Kept.Reserve(FMath::Max(0, KeptLast - KeptFirst + 1));
+
+    for (FRealizedButton& Realized : RealizedButtons)
+    {
+        if (Realized.ItemIndex >= KeptFirst && Realized.ItemIndex <= KeptLast)
+        {
+            Kept.Add(MoveTemp(Realized));
+            continue;
         }
 
-        const float DesiredButtonWidth = FMath::Max(ButtonExtentValue, LabelMeasuredWidth + LabelHorizontalPadding);
+        ButtonListContainer->RemoveSlot(Realized.SizeBox.ToSharedRef());
+        Realized.ItemIndex = INDEX_NONE;
+        RecycledButtons.Add(MoveTemp(Realized));
+    }
 
-        const float LeftPadding = (ItemIndex == 0) ? ComputedGap : HalfGap;
-        const float RightPadding = (ItemIndex == ButtonItems.Num() - 1) ? ComputedGap : HalfGap;
+    // Slot 0 is the leading spacer, so the button for item FirstIndex + N sits in slot N + 1.
+    const int32 LeadingEnd = Kept.Num() > 0 ? KeptFirst : LastIndex + 1;
+    for (int32 ItemIndex = FirstIndex; ItemIndex < LeadingEnd; ++ItemIndex)
+    {
+        FRealizedButton& Realized = NextRealized.AddDefaulted_GetRef();
+        AcquireRealizedButton(Realized, ItemIndex);
+        InsertVirtualizedSlot(1 + ItemIndex - FirstIndex, Realized);
+    }
 
-        ButtonListContainer->AddSlot()
-        .AutoWidth()
-        .Padding(FMargin(LeftPadding, 0.f, RightPadding, 0.f))
-        .HAlign(HAlign_Center)
-        [
-            SNew(SBox)
-            .WidthOverride(DesiredButtonWidth)
-            .HeightOverride(ButtonExtentAttribute)
-            [
-                SNew(SIconTextButtonWidget)
-                .IconBrush(StoredBrush.Get())
-                .IconColor(FLinearColor::White)
-                .Label(Item.Label)
-                .Font(ButtonLabelFont)
-                .LabelColor(FSlateColor(FLinearColor::White))
-                .IconSize(IconBoxSize)
-                .Spacing(LabelSpacing)
-                .LabelMaxWidth(DesiredButtonWidth)
-            ]
-        ];
+    NextRealized.Append(MoveTemp(Kept));
+
+    for (int32 ItemIndex = FirstIndex + NextRealized.Num(); ItemIndex <= LastIndex; ++ItemIndex)
+    {
+        FRealizedButton& Realized = NextRealized.AddDefaulted_GetRef();
+        AcquireRealizedButton(Realized, ItemIndex);
+        InsertVirtualizedSlot(ButtonListContainer->NumSlots() - 1, Realized);
     }
 
-    if (ButtonScrollBox.IsValid())
+    RealizedButtons = MoveTemp(NextRealized);
+}
+
+void SListBuildingContainerWidget::AcquireRealizedButton(FRealizedButton& Realized, int32 ItemIndex)
+{
+    if (!Realized.SizeBox.IsValid() && RecycledButtons.Num() > 0)
     {
-        ButtonScrollBox->ScrollToStart();
+        Realized = RecycledButtons.Pop(EAllowShrinking::No);
+    }
+
+    BindRealizedButton(Realized, ItemIndex);
+}
+
+void SListBuildingContainerWidget::InsertVirtualizedSlot(int32 SlotIndex, const FRealizedButton& Realized)
+{
+    ButtonListContainer->InsertSlot(SlotIndex)
+    .AutoWidth()
+    .Padding(ButtonSlotLayouts[Realized.ItemIndex].Padding)
+    .HAlign(HAlign_Center)
+    [
+        Realized.SizeBox.ToSharedRef()
+    ];
+}
+
+void SListBuildingContainerWidget::ReleaseRealizedButtons()
+{
+    for (FRealizedButton& Realized : RealizedButtons)
+    {
+        Realized.ItemIndex = INDEX_NONE;
+        RecycledButtons.Add(MoveTemp(Realized));
+    }
+
+    RealizedButtons.Reset();
+    RealizedFirstIndex = INDEX_NONE;
+    RealizedLastIndex = INDEX_NONE;
+
+    if (!bVirtualizationEnabled)
+    {
+        RecycledButtons.Reset();
     }
 }
 
+void SListBuildingContainerWidget::HandleButtonListScrolled(float ScrollOffset)
+{
+    RefreshVirtualizedWindow(false);
+}
 
 FReply SListBuildingContainerWidget::HandleScrollAreaMouseButtonDown(const FGeometry& Geometry, const FPointerEvent& PointerEvent)
 {
@@ -492,6 +1096,7 @@ FReply SListBuildingContainerWidget::HandleScrollAreaMouseMove(const FGeometry&
     const float MaxOffset = FMath::Max(0.f, ButtonScrollBox->GetScrollOffsetOfEnd());
     const float TargetOffset = FMath::Clamp(ScrollDragStartOffset - DragDelta.X, 0.f, MaxOffset);
     ButtonScrollBox->SetScrollOffset(TargetOffset);
+    RefreshVirtualizedWindow(false);
     return FReply::Handled();
 }
 
@@ -501,23 +1106,58 @@ void SListBuildingContainerWidget::EndScrollDrag()
     bIsDraggingScroll = false;
 }
 
-void SListBuildingContainerWidget::Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime)
+void SListBuildingContainerWidget::HandleScrollAreaResized(const FVector2D& NewSize)
 {
-    SCompoundWidget::Tick(AllottedGeometry, InCurrentTime, InDeltaTime);
+    CachedScrollSize = NewSize;
+    CachedButtonExtent = FMath::Max(1.f, NewSize.Y);
+    CachedContainerWidth = NewSize.X;
 
-    if (!ScrollInteractionLayer.IsValid())
+    // The size is reported from inside the arrange pass; apply the new layout on the next frame instead.
+    if (!bRelayoutPending)
+    {
+        bRelayoutPending = true;
+        RegisterActiveTimer(0.f, FWidgetActiveTimerDelegate::CreateSP(this, &SListBuildingContainerWidget::HandleDeferredRelayout));
+    }
+}
+
+EActiveTimerReturnType SListBuildingContainerWidget::HandleDeferredRelayout(double InCurrentTime, float InDeltaTime)
+{
+    bRelayoutPending = false;
+    RelayoutButtonList();
+    return EActiveTimerReturnType::Stop;
+}
+
+void SListBuildingContainerWidget::RelayoutButtonList()
+{
+    if (!ButtonListContainer.IsValid() || ButtonItems.Num() <= 0)
     {
         return;
     }
 
-    const FVector2D CurrentSize = ScrollInteractionLayer->GetCachedGeometry().GetLocalSize();
-    if (!CurrentSize.IsNearlyZero() && !CurrentSize.Equals(CachedScrollSize, 0.5f))
+    if (ButtonSlotLayouts.Num() != ButtonItems.Num()
+        || (!bVirtualizationEnabled && RealizedButtons.Num() != ButtonItems.Num()))
     {
-        CachedScrollSize = CurrentSize;
-        CachedButtonExtent = FMath::Max(1.f, CurrentSize.Y);
-        CachedContainerWidth = CurrentSize.X;
         RebuildButtonList();
+        return;
     }
+
+    ComputeButtonLayouts();
+
+    for (FRealizedButton& Realized : RealizedButtons)
+    {
+        if (ButtonSlotLayouts.IsValidIndex(Realized.ItemIndex))
+        {
+            ApplySlotLayout(Realized);
+        }
+    }
+
+    if (bVirtualizationEnabled)
+    {
+        RefreshVirtualizedWindow(true);
+        return;
+    }
+
+    ApplySlotPaddings();
 }
 
 FOptionalSize SListBuildingContainerWidget::GetButtonExtent() const
@@ -80,44 +80,24 @@ void SMainWindowWidget::BuildLayout()
             ]
         ];
 
+    // Four stacked rings (outer frame, secondary rim, surface, accent keyline) painted as one draw element.
+    constexpr float FrameFeather = 1.f;
+    TArray<FBeveledBorderLayer> FrameLayers;
+    FrameLayers.Reserve(4);
+    FrameLayers.Emplace(FMargin(0.f),  10.f, 12.f, 16.f, PrimaryColor,         FrameFeather);
+    FrameLayers.Emplace(FMargin(8.f),  8.f,  12.f, 16.f, SecondaryColor * 0.9f, FrameFeather);
+    FrameLayers.Emplace(FMargin(14.f), 8.f,  12.f, 16.f, SurfaceColor,         FrameFeather);
+    FrameLayers.Emplace(FMargin(20.f), 8.f,  12.f, 16.f, AccentColor,          FrameFeather);
+
     ChildSlot
     [
         SNew(SBeveledBorder)
-        .Bevel(10.f)
-        .NotchDepth(12.f)
+        .Layers(MoveTemp(FrameLayers))
         .RightNotchCount(3)
         .LeftNotchCount(2)
-        .Color(PrimaryColor)
-        .Padding(FMargin(8.f))
+        .Padding(FMargin(26.f))
         [
-            SNew(SBeveledBorder)
-            .Bevel(8.f)
-            .NotchDepth(12.f)
-            .RightNotchCount(3)
-            .LeftNotchCount(2)
-            .Color(SecondaryColor * 0.9f)
-            .Padding(FMargin(6.f))
-            [
-                SNew(SBeveledBorder)
-                .Bevel(8.f)
-                .NotchDepth(12.f)
-                .RightNotchCount(3)
-                .LeftNotchCount(2)
-                .Color(SurfaceColor)
-                .Padding(FMargin(6.f))
-                [
-                    SNew(SBeveledBorder)
-                    .Bevel(8.f)
-                    .NotchDepth(12.f)
-                    .RightNotchCount(3)
-                    .LeftNotchCount(2)
-                    .Color(AccentColor)
-                    .Padding(FMargin(6.f))
-                    [
-                        WindowOverlay
-                    ]
-                ]
-            ]
+            WindowOverlay
         ]
     ];
 
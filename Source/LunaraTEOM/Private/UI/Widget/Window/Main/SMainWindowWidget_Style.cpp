@@ -17,7 +17,7 @@ void SMainWindowWidget::ResolveStyle(const FLunaraTeomSlateStyle* InStyle)
     if (!StyleRef)
     {
         if (USlateWidgetStyleAsset* StyleAsset =
-            LoadObject<USlateWidgetStyleAsset>(nullptr, TEXT("/Game/UI/Styles/LunaraStyle.LunaraStyle")))
+            LoadObject<USlateWidgetStyleAsset>(nullptr, FLunaraTeomSlateStyle::AssetPath))
         {
             if (const FLunaraTeomSlateStyle* Resolved = StyleAsset->GetStyle<FLunaraTeomSlateStyle>())
             {
@@ -1,11 +1,13 @@
 #include "UI/Wrapper/UIconButtonWidget.h"
 #include "UI/Widget/Button/Icon/SIconButtonWidget.h"
+#include "UI/Widget/Button/Icon/IconAssetStreamer.h"
 
 TSharedRef<SWidget> UIconButtonWidget::RebuildWidget()
 {
     SAssignNew(MySlate, SIconButtonWidget)
         .IconAsset(IconAsset)
         .Diameter(Diameter)
+        .AsyncLoadIcon(bAsyncLoadIcon)
         .OnClicked(FOnSlateIconButtonClicked::CreateUObject(this, &UIconButtonWidget::HandleSlateClicked))
         .OnPressed(FSimpleDelegate::CreateUObject(this, &UIconButtonWidget::HandleSlatePressed))
         .OnReleased(FSimpleDelegate::CreateUObject(this, &UIconButtonWidget::HandleSlateReleased))
@@ -27,11 +29,22 @@ void UIconButtonWidget::SynchronizeProperties()
 
     if (MySlate.IsValid())
     {
+        MySlate->SetAsyncLoadIcon(bAsyncLoadIcon);
         MySlate->SetDiameter(Diameter);
         MySlate->SetIconAsset(IconAsset);
     }
 }
 
+void UIconButtonWidget::PrefetchIcons(const TArray<TSoftObjectPtr<UObject>>& Icons)
+{
+    FIconAssetStreamer::Get().Prefetch(Icons);
+}
+
+void UIconButtonWidget::ReleasePrefetchedIcons()
+{
+    FIconAssetStreamer::Get().ReleasePrefetched();
+}
+
 FReply UIconButtonWidget::HandleSlateClicked()
 {
     OnClicked.Broadcast();
@@ -9,7 +9,9 @@ UListBuildingContainerWidget::UListBuildingContainerWidget()
 
 TSharedRef<SWidget> UListBuildingContainerWidget::RebuildWidget()
 {
-    SAssignNew(MySlate, SListBuildingContainerWidget);
+    SAssignNew(MySlate, SListBuildingContainerWidget)
+        .EnableVirtualization(bVirtualizeButtons)
+        .VirtualizationOverscan(VirtualizationOverscan);
 
     if (GetContent())
     {
@@ -38,6 +40,7 @@ void UListBuildingContainerWidget::SynchronizeProperties()
 
     if (MySlate.IsValid())
     {
+        MySlate->SetVirtualization(bVirtualizeButtons, VirtualizationOverscan);
         MySlate->SetButtonFont(ButtonFont);
         MySlate->SetButtonItems(ButtonItems);
     }
@@ -79,13 +82,24 @@ void UListBuildingContainerWidget::SetButtonItems(const TArray<FListBuildingButt
     }
 }
 
+void UListBuildingContainerWidget::SetVirtualizeButtons(bool bInVirtualize, int32 InOverscan)
+{
+    bVirtualizeButtons = bInVirtualize;
+    VirtualizationOverscan = FMath::Max(0, InOverscan);
+
+    if (MySlate.IsValid())
+    {
+        MySlate->SetVirtualization(bVirtualizeButtons, VirtualizationOverscan);
+    }
+}
+
 void UListBuildingContainerWidget::AddButtonItem(const FListBuildingButtonItem& NewItem)
 {
     ButtonItems.Add(NewItem);
 
     if (MySlate.IsValid())
     {
-        MySlate->SetButtonItems(ButtonItems);
+        MySlate->InsertButtonItem(ButtonItems.Num() - 1, NewItem);
     }
 }
 
@@ -100,7 +114,7 @@ void UListBuildingContainerWidget::UpdateButtonItem(int32 Index, const FListBuil
 
     if (MySlate.IsValid())
     {
-        MySlate->SetButtonItems(ButtonItems);
+        MySlate->UpdateButtonItem(Index, UpdatedItem);
     }
 }
 
@@ -115,7 +129,24 @@ void UListBuildingContainerWidget::RemoveButtonItemAt(int32 Index)
 
     if (MySlate.IsValid())
     {
-        MySlate->SetButtonItems(ButtonItems);
+        MySlate->RemoveButtonItemAt(Index);
+    }
+}
+
+void UListBuildingContainerWidget::MoveButtonItem(int32 FromIndex, int32 ToIndex)
+{
+    if (!ButtonItems.IsValidIndex(FromIndex) || !ButtonItems.IsValidIndex(ToIndex) || FromIndex == ToIndex)
+    {
+        return;
+    }
+
+    FListBuildingButtonItem MovedItem = ButtonItems[FromIndex];
+    ButtonItems.RemoveAt(FromIndex);
+    ButtonItems.Insert(MoveTemp(MovedItem), ToIndex);
+
+    if (MySlate.IsValid())
+    {
+        MySlate->MoveButtonItem(FromIndex, ToIndex);
     }
 }
 
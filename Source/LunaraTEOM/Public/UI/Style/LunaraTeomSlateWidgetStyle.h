@@ -11,13 +11,37 @@ struct FLunaraTeomSlateStyle : public FSlateWidgetStyle
 	GENERATED_BODY()
 
 	static const FName TypeName;
+
+	/** Style asset the Lunara widgets read before falling back to GetDefault(). */
+	static const TCHAR* const AssetPath;
+
 	virtual const FName GetTypeName() const override { return TypeName; }
 	static const FLunaraTeomSlateStyle& GetDefault();
 
+	/** Resolves the fonts synchronously; only the shared default defers that to the warm-up. */
 	FLunaraTeomSlateStyle();
 	virtual ~FLunaraTeomSlateStyle();
 	virtual void GetResources(TArray<const FSlateBrush*>& OutBrushes) const override;
 
+	/** Appends the soft paths of every font face referenced by this style. */
+	void GetFontFacePaths(TArray<FSoftObjectPath>& OutPaths) const;
+
+	/** Appends the runtime fonts built from the font faces. */
+	void GetRuntimeFonts(TArray<const FSlateFontInfo*>& OutFonts) const;
+
+	/**
+	 * Rebuilds the runtime fonts from their faces. Faces that are not resident are loaded
+	 * synchronously only when bAllowSyncLoad is set; otherwise the current font is kept, or the
+	 * core default font stands in when there is none yet.
+	 * Returns true once every referenced face was resolved.
+	 */
+	bool ResolveFonts(bool bAllowSyncLoad);
+
+	bool AreFontsResolved() const { return bFontsResolved; }
+
+	/** Rebuilds the runtime fonts of an instance loaded from a style asset. */
+	void PostSerialize(const FArchive& Ar);
+
         /** Primary surface tint applied to window bodies and cards. */
         UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Lunara|Colors")
         FLinearColor SurfaceColor = FLinearColor(0.658f, 0.478f, 0.176f);
@@ -93,4 +117,27 @@ struct FLunaraTeomSlateStyle : public FSlateWidgetStyle
         /** Runtime Slate font built from CinzelBlackFace. */
         UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Lunara|Fonts")
         FSlateFontInfo CinzelBlack;
+
+private:
+	friend class FLunaraTeomStyleWarmUp;
+
+	/**
+	 * Shared default instance without forcing its fonts to resolve. Used by the style warm-up,
+	 * which streams the faces asynchronously instead of letting GetDefault() load them in-frame.
+	 */
+	static FLunaraTeomSlateStyle& GetMutableDefault();
+
+	enum class EDeferFontResolve { Tag };
+	explicit FLunaraTeomSlateStyle(EDeferFontResolve);
+
+	bool bFontsResolved = false;
+};
+
+template<>
+struct TStructOpsTypeTraits<FLunaraTeomSlateStyle> : public TStructOpsTypeTraitsBase2<FLunaraTeomSlateStyle>
+{
+	enum
+	{
+		WithPostSerialize = true,
+	};
 };
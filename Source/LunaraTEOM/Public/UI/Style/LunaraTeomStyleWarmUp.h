@@ -0,0 +1,55 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Fonts/SlateFontInfo.h"
+
+struct FStreamableHandle;
+
+/**
+ * Prepares FLunaraTeomSlateStyle ahead of the first UI open: streams every font face in one
+ * async request and rebuilds the shared default's fonts once they are resident. It then streams
+ * the LunaraStyle asset the widgets read, whose style resolves its own fonts on load, and
+ * rasterizes the common Latin glyph ranges of both into the Slate font atlas, one font/size pair
+ * per frame.
+ * Intended to be started from the loading screen.
+ */
+class LUNARATEOM_API FLunaraTeomStyleWarmUp
+{
+public:
+    static FLunaraTeomStyleWarmUp& Get();
+
+    /**
+     * Starts the warm-up if it is not already running or done. OnComplete runs once everything
+     * is cached, immediately if that already happened. FontSizes overrides the point sizes whose
+     * glyphs get rasterized; when empty the sizes used by the stock widgets are warmed.
+     */
+    void Start(FSimpleDelegate OnComplete = FSimpleDelegate(), const TArray<int32>& FontSizes = TArray<int32>());
+
+    bool IsRunning() const { return State == EState::Streaming || State == EState::Rasterizing; }
+    bool IsComplete() const { return State == EState::Complete; }
+
+private:
+    enum class EState : uint8
+    {
+        Idle,
+        Streaming,
+        Rasterizing,
+        Complete
+    };
+
+    FLunaraTeomStyleWarmUp() = default;
+
+    void HandleFacesLoaded();
+    void HandleStyleAssetLoaded();
+    bool TickRasterize(float DeltaTime);
+    void Finish();
+
+    EState State = EState::Idle;
+    TArray<FSimpleDelegate> CompletionWaiters;
+    TArray<int32> WarmFontSizes;
+    TArray<FSlateFontInfo> PendingFonts;
+    TSharedPtr<FStreamableHandle> FacesHandle;
+    TSharedPtr<FStreamableHandle> StyleAssetHandle;
+    FTSTicker::FDelegateHandle RasterizeTickerHandle;
+};
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/SoftObjectPath.h"
+#include "UObject/SoftObjectPtr.h"
+#include "Containers/Ticker.h"
+
+struct FStreamableHandle;
+
+DECLARE_DELEGATE_OneParam(FOnIconAssetStreamed, UObject* /*LoadedAsset*/)
+
+/**
+ * Streams icon assets for icon buttons through the asset manager's streamable manager.
+ * Requests made during the same frame are batched into a single async load, and every
+ * widget waiting on the batch is notified in one pass when it completes.
+ */
+class LUNARATEOM_API FIconAssetStreamer
+{
+public:
+    static FIconAssetStreamer& Get();
+
+    /**
+     * Queues Path for async loading. If the asset is already resident the callback runs immediately.
+     * Bind the callback with CreateSP so destroyed widgets are skipped.
+     */
+    void RequestIcon(const FSoftObjectPath& Path, FOnIconAssetStreamed&& OnStreamed);
+
+    /** Starts loading Icons ahead of time (e.g. before a panel opens) and keeps them resident until released. */
+    void Prefetch(const TArray<TSoftObjectPtr<UObject>>& Icons, FSimpleDelegate OnComplete = FSimpleDelegate());
+    void ReleasePrefetched();
+
+private:
+    FIconAssetStreamer() = default;
+
+    bool FlushPendingRequests(float DeltaTime);
+    void HandleBatchLoaded(TArray<FSoftObjectPath> BatchPaths);
+
+    TMap<FSoftObjectPath, TArray<FOnIconAssetStreamed>> Waiters;
+    TArray<FSoftObjectPath> PendingPaths;
+    FTSTicker::FDelegateHandle FlushTickerHandle;
+    TArray<TSharedPtr<FStreamableHandle>> PrefetchHandles;
+};
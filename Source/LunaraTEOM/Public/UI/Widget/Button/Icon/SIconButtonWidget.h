@@ -6,6 +6,8 @@
 #include "Styling/SlateTypes.h"
 #include "Animation/CurveSequence.h"
 #include "Rendering/SlateRenderTransform.h"
+#include "Rendering/RenderingCommon.h"
+#include "Rendering/SlateResourceHandle.h"
 
 struct FLunaraTeomSlateStyle;
 
@@ -22,10 +24,16 @@ public:
         : _Style(nullptr)
         , _IconAsset(nullptr)
         , _Diameter(64.f)
+        , _AsyncLoadIcon(false)
+        , _PlaceholderBrush(nullptr)
     {}
         SLATE_ARGUMENT(const FLunaraTeomSlateStyle*, Style)
         SLATE_ARGUMENT(TSoftObjectPtr<UObject>, IconAsset)
         SLATE_ARGUMENT(float, Diameter)
+        /** Stream the icon asset asynchronously instead of loading it on the game thread. */
+        SLATE_ARGUMENT(bool, AsyncLoadIcon)
+        /** Brush shown while an async icon is streaming; a faint disc is used when unset. */
+        SLATE_ARGUMENT(const FSlateBrush*, PlaceholderBrush)
         SLATE_EVENT(FOnSlateIconButtonClicked, OnClicked)
         SLATE_EVENT(FSimpleDelegate, OnPressed)
         SLATE_EVENT(FSimpleDelegate, OnReleased)
@@ -37,6 +45,7 @@ public:
 
     void SetIconAsset(TSoftObjectPtr<UObject> InIconAsset);
     void SetDiameter(float InDiameter);
+    void SetAsyncLoadIcon(bool bInAsyncLoad);
 
 private:
     void BuildLayout();
@@ -49,6 +58,9 @@ private:
 
     void ResolveStyle(const FLunaraTeomSlateStyle* InStyle);
     void RefreshIconBrush();
+    void ApplyIconObject(UObject* IconObject);
+    void ShowPlaceholderIcon();
+    void HandleIconStreamed(UObject* LoadedAsset, FSoftObjectPath RequestedPath);
 
     float GetHoverAlpha() const;
     float GetPressAlpha() const;
@@ -91,7 +103,11 @@ private:
     FLinearColor FillBase        = FLinearColor::Black;
 
     TSoftObjectPtr<UObject> IconAsset;
+    TWeakObjectPtr<UObject> ResolvedIconObject;
     FSlateBrush IconBrush;
+    const FSlateBrush* PlaceholderBrush = nullptr;
+    bool bAsyncLoadIcon = false;
+    bool bIconStreaming = false;
 
     float ButtonDiameter = 64.f;
     float IconScale = 0.55f;
@@ -99,4 +115,8 @@ private:
     TSharedPtr<SBox> ButtonBox;
     TSharedPtr<SBox> IconBox;
     TSharedPtr<SImage> IconImage;
+
+    /** Per-paint scratch for the notched fill; reused so painting does not allocate. */
+    mutable TArray<FSlateVertex> NotchedFillVertices;
+    mutable FSlateResourceHandle WhiteBrushHandle;
 };
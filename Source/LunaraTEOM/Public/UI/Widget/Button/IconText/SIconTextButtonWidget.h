@@ -5,6 +5,11 @@
 #include "Fonts/SlateFontInfo.h"
 #include "Styling/SlateColor.h"
 #include "Styling/SlateBrush.h"
+#include "Widgets/SBoxPanel.h"
+
+class SBox;
+class SImage;
+class STextBlock;
 
 class LUNARATEOM_API SIconTextButtonWidget : public SCompoundWidget
 {
@@ -33,7 +38,17 @@ public:
 
     void Construct(const FArguments& InArgs);
 
+    /** Rebinds the displayed content so pooled buttons can be reused for a different item. */
+    void SetIconBrush(const TAttribute<const FSlateBrush*>& InIconBrush);
+    void SetLabel(const TAttribute<FText>& InLabel);
+    void SetFont(const TAttribute<FSlateFontInfo>& InFont);
+    void SetIconSize(float InIconSize);
+    void SetSpacing(float InSpacing);
+    void SetLabelMaxWidth(float InLabelMaxWidth);
+
 private:
+    void RefreshContentLayout();
+
     TAttribute<const FSlateBrush*> IconBrushAttr;
     TAttribute<FSlateColor> IconColorAttr;
     TAttribute<FText> LabelAttr;
@@ -43,4 +58,10 @@ private:
     float IconSize = 48.f;
     float Spacing = 6.f;
     float LabelMaxWidth = 0.f;
+
+    TSharedPtr<SBox> IconBox;
+    TSharedPtr<SImage> IconImage;
+    TSharedPtr<SBox> LabelBox;
+    TSharedPtr<STextBlock> LabelText;
+    SVerticalBox::FSlot* LabelSlot = nullptr;
 };
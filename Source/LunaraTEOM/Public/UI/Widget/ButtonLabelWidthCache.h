@@ -0,0 +1,59 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Fonts/SlateFontInfo.h"
+
+/**
+ * Process-wide cache of measured button label widths, keyed by (text, font, scale).
+ * Shared by every building list so rebuilds and relayouts do not re-shape the same labels.
+ * The font is part of the key, so a list switching fonts leaves other lists' entries intact;
+ * the cache is bounded by an entry cap and flushed when the active culture changes.
+ */
+class LUNARATEOM_API FButtonLabelWidthCache
+{
+public:
+    struct FStats
+    {
+        uint64 Hits = 0;
+        uint64 Misses = 0;
+        int32 Entries = 0;
+    };
+
+    static FButtonLabelWidthCache& Get();
+
+    /** Returns the measured width of InText, measuring through the Slate font service on a miss. */
+    float Measure(const FText& InText, const FSlateFontInfo& InFont, float InScale = 1.f);
+
+    void InvalidateAll();
+
+    FStats GetStats() const;
+    void ResetStats();
+
+private:
+    FButtonLabelWidthCache();
+    ~FButtonLabelWidthCache();
+
+    void HandleCultureChanged();
+
+    struct FKey
+    {
+        FString Text;
+        FSlateFontInfo Font;
+        float Scale = 1.f;
+
+        bool operator==(const FKey& Other) const
+        {
+            return Scale == Other.Scale && Font == Other.Font && Text.Equals(Other.Text, ESearchCase::CaseSensitive);
+        }
+
+        friend uint32 GetTypeHash(const FKey& Key)
+        {
+            return HashCombine(HashCombine(GetTypeHash(Key.Text), GetTypeHash(Key.Font)), GetTypeHash(Key.Scale));
+        }
+    };
+
+    TMap<FKey, float> Widths;
+    uint64 HitCount = 0;
+    uint64 MissCount = 0;
+    FDelegateHandle CultureChangedHandle;
+};
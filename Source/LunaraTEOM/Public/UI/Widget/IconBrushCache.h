@@ -0,0 +1,41 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Styling/SlateBrush.h"
+#include "UObject/ObjectKey.h"
+
+/**
+ * Process-wide cache of resolved icon brushes, keyed by the source resource object.
+ * Identical source brushes share one resolved FSlateBrush (and therefore one render resource handle).
+ * Brushes are reference counted through their shared pointer; entries only the cache still holds
+ * are evicted once the cache grows past its budget or their resource object is gone.
+ */
+class LUNARATEOM_API FIconBrushCache
+{
+public:
+    static FIconBrushCache& Get();
+
+    /**
+     * Returns the shared resolved brush for InSource (vector art as vector, SVG data rebound to its texture).
+     * Callers keep the returned pointer alive for as long as they display it.
+     */
+    TSharedPtr<FSlateBrush> Acquire(const FSlateBrush& InSource);
+
+    /** Evicts entries that are no longer referenced outside the cache. */
+    void Trim();
+
+    int32 Num() const;
+
+private:
+    struct FEntry
+    {
+        FSlateBrush Source;
+        TWeakObjectPtr<UObject> SourceObject;
+        TSharedRef<FSlateBrush> Resolved;
+    };
+
+    static TSharedRef<FSlateBrush> Resolve(const FSlateBrush& InSource);
+
+    TMap<FObjectKey, TArray<FEntry>> EntriesByResource;
+    int32 EntryCount = 0;
+};
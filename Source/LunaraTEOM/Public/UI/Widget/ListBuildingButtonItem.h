@@ -14,4 +14,15 @@ struct FListBuildingButtonItem
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "List Building")
     FSlateBrush Icon;
+
+    bool operator==(const FListBuildingButtonItem& Other) const
+    {
+        return Icon == Other.Icon
+            && Label.IdenticalTo(Other.Label, ETextIdenticalModeFlags::DeepCompare | ETextIdenticalModeFlags::LexicalCompareInvariants);
+    }
+
+    bool operator!=(const FListBuildingButtonItem& Other) const
+    {
+        return !(*this == Other);
+    }
 };
@@ -2,6 +2,8 @@
 
 #include "CoreMinimal.h"
 #include "Widgets/SCompoundWidget.h"
+#include "Rendering/RenderingCommon.h"
+#include "Rendering/SlateResourceHandle.h"
 
 // Gunakan 'class' sesuai deklarasi asli UE untuk hindari C4099.
 class FPaintArgs;
@@ -11,6 +13,31 @@ class FWidgetStyle;
 // FGeometry sudah tersedia via SCompoundWidget.h; forward-declare opsional:
 // struct FGeometry;
 
+/**
+ * One ring of a layered SBeveledBorder. Inset is measured from the widget bounds;
+ * Feather adds an anti-aliased fringe of that width (0 keeps a hard edge).
+ */
+struct FBeveledBorderLayer
+{
+    FBeveledBorderLayer() = default;
+
+    FBeveledBorderLayer(const FMargin& InInset, float InBevel, float InNotchDepth, float InNotchHeight, const FLinearColor& InColor, float InFeather = 0.f)
+        : Inset(InInset)
+        , Bevel(InBevel)
+        , NotchDepth(InNotchDepth)
+        , NotchHeight(InNotchHeight)
+        , Color(InColor)
+        , Feather(InFeather)
+    {}
+
+    FMargin      Inset = FMargin(0.f);
+    float        Bevel = 8.f;
+    float        NotchDepth = 8.f;
+    float        NotchHeight = 16.f;
+    FLinearColor Color = FLinearColor::White;
+    float        Feather = 0.f;
+};
+
 /**
  * Beveled + notch border (Slate)
  * Header ini hanya deklarasi; seluruh logic rendering ada di .cpp
@@ -34,6 +61,8 @@ public:
         SLATE_ATTRIBUTE(float,        NotchHeight)
         SLATE_ATTRIBUTE(int32,        RightNotchCount)
         SLATE_ATTRIBUTE(int32,        LeftNotchCount)
+        /** When set, replaces Bevel/Color/Notch* with stacked rings emitted as one draw element. */
+        SLATE_ARGUMENT(TArray<FBeveledBorderLayer>, Layers)
         SLATE_DEFAULT_SLOT(FArguments, Content)
     SLATE_END_ARGS()
 
@@ -49,6 +78,36 @@ public:
         bool bParentEnabled) const override;
 
 private:
+    /** Geometry of one ring after attribute resolution; together with the size it keys the mesh cache. */
+    struct FResolvedLayer
+    {
+        FVector2f Offset = FVector2f::ZeroVector;
+        FVector2f Size = FVector2f::ZeroVector;
+        float Bevel = 0.f;
+        float NotchDepth = 0.f;
+        float NotchHeight = 0.f;
+        float Feather = 0.f;
+
+        bool operator==(const FResolvedLayer& Other) const
+        {
+            return Offset == Other.Offset
+                && Size == Other.Size
+                && Bevel == Other.Bevel
+                && NotchDepth == Other.NotchDepth
+                && NotchHeight == Other.NotchHeight
+                && Feather == Other.Feather;
+        }
+    };
+
+    using FResolvedLayerArray = TArray<FResolvedLayer, TInlineAllocator<8>>;
+
+    void ResolveLayers(const FVector2f& LocalSize, FResolvedLayerArray& OutLayers) const;
+    bool IsMeshCacheValid(const FResolvedLayerArray& Layers, int32 RightCount, int32 LeftCount) const;
+    void TessellateLayers(const FResolvedLayerArray& Layers, int32 RightCount, int32 LeftCount) const;
+    void TessellateLayer(int32 LayerIndex, const FResolvedLayer& Layer, int32 RightCount, int32 LeftCount) const;
+
+    TArray<FBeveledBorderLayer> Layers;
+
     TAttribute<float>        BevelAttr;
     TAttribute<FLinearColor> ColorAttr;
     TAttribute<FMargin>      PaddingAttr;
@@ -56,4 +115,18 @@ private:
     TAttribute<float>        NotchHeightAttr;
     TAttribute<int32>        RightNotchCountAttr;
     TAttribute<int32>        LeftNotchCountAttr;
+
+    // Local-space mesh for every ring, rebuilt only when the resolved layer geometry changes.
+    // Each point remembers its ring and whether it is an opaque outline point or a transparent feather point.
+    mutable TArray<FResolvedLayer>   CachedLayers;
+    mutable int32                    CachedRightNotchCount = INDEX_NONE;
+    mutable int32                    CachedLeftNotchCount = INDEX_NONE;
+    mutable TArray<FVector2f>        CachedPoints;
+    mutable TArray<uint8>            CachedPointLayers;
+    mutable TArray<uint8>            CachedPointOpaque;
+    mutable TArray<SlateIndex>       CachedIndices;
+    // Reused every paint so transforming the cached mesh does not allocate.
+    mutable TArray<FSlateVertex>     PaintVertices;
+    mutable TArray<FVector2f>        ScratchOutline;
+    mutable FSlateResourceHandle     WhiteBrushHandle;
 };
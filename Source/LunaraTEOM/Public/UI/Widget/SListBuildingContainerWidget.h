@@ -11,13 +11,21 @@ class SBeveledBorder;
 class SScrollBox;
 class SHorizontalBox;
 class SBorder;
+class SBox;
+class SIconTextButtonWidget;
 
 class LUNARATEOM_API SListBuildingContainerWidget : public SCompoundWidget
 {
 public:
     SLATE_BEGIN_ARGS(SListBuildingContainerWidget)
+        : _EnableVirtualization(false)
+        , _VirtualizationOverscan(2)
     {}
         SLATE_DEFAULT_SLOT(FArguments, Content)
+        /** Only realize buttons inside the visible scroll window (plus overscan) and recycle them while scrolling. */
+        SLATE_ARGUMENT(bool, EnableVirtualization)
+        /** Number of extra buttons kept alive on each side of the visible window when virtualized. */
+        SLATE_ARGUMENT(int32, VirtualizationOverscan)
     SLATE_END_ARGS()
 
     void Construct(const FArguments& InArgs);
@@ -30,18 +38,66 @@ public:
 
     void SetButtonFont(const FSlateFontInfo& InFont);
 
+    /** Single-item edits that only touch the affected slots instead of rebuilding the whole list. */
+    void InsertButtonItem(int32 Index, const FListBuildingButtonItem& InItem);
+    void UpdateButtonItem(int32 Index, const FListBuildingButtonItem& InItem);
+    void RemoveButtonItemAt(int32 Index);
+    void MoveButtonItem(int32 FromIndex, int32 ToIndex);
+
+    void SetVirtualization(bool bInEnabled, int32 InOverscan);
+    bool IsVirtualizationEnabled() const { return bVirtualizationEnabled; }
+
 private:
+    /** Values shared by every slot; the gap depends on the item count, everything else on the button extent. */
+    struct FButtonListMetrics
+    {
+        float ButtonExtent = 116.f;
+        float Gap = 20.f;
+        float LabelSpacing = 0.f;
+        float LabelHorizontalPadding = 0.f;
+    };
+
+    /** Precomputed horizontal layout of one button slot, shared by the full and virtualized paths. */
+    struct FButtonSlotLayout
+    {
+        float Width = 0.f;
+        float IconSize = 0.f;
+        float LabelSpacing = 0.f;
+        FMargin Padding;
+    };
+
+    /** Button widget that is currently realized (or pooled) by the virtualized path. */
+    struct FRealizedButton
+    {
+        int32 ItemIndex = INDEX_NONE;
+        TSharedPtr<SBox> SizeBox;
+        TSharedPtr<SIconTextButtonWidget> Button;
+    };
+
     TSharedPtr<class SBeveledBorder> ContentBorder;
     TSharedPtr<SWidget> CachedContent;
     TSharedPtr<class SBox> CustomContentSlot;
     TSharedPtr<class SScrollBox> ButtonScrollBox;
     TSharedPtr<class SHorizontalBox> ButtonListContainer;
     TSharedPtr<class SBorder> ScrollInteractionLayer;
+    TSharedPtr<SBox> LeadingSpacer;
+    TSharedPtr<SBox> TrailingSpacer;
     TArray<FListBuildingButtonItem> ButtonItems;
     TArray<TSharedPtr<FSlateBrush>> ButtonIconBrushes;
+    TArray<FButtonSlotLayout> ButtonSlotLayouts;
+    TArray<float> ButtonSlotOffsets;
+    FButtonListMetrics CachedListMetrics;
+
+    bool bVirtualizationEnabled = false;
+    int32 VirtualizationOverscan = 2;
+    int32 RealizedFirstIndex = INDEX_NONE;
+    int32 RealizedLastIndex = INDEX_NONE;
+    TArray<FRealizedButton> RealizedButtons;
+    TArray<FRealizedButton> RecycledButtons;
 
     FSlateFontInfo ButtonLabelFont;
 
+    bool bRelayoutPending = false;
     bool bPendingScrollDrag = false;
     bool bIsDraggingScroll = false;
     FVector2D ScrollDragStartPosition = FVector2D::ZeroVector;
@@ -51,7 +107,28 @@ private:
     mutable FVector2D CachedScrollSize = FVector2D::ZeroVector;
 
     void RebuildButtonList();
-    virtual void Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime) override;
+    void RelayoutButtonList();
+    void HandleScrollAreaResized(const FVector2D& NewSize);
+    EActiveTimerReturnType HandleDeferredRelayout(double InCurrentTime, float InDeltaTime);
+    void ComputeButtonLayouts();
+    FButtonListMetrics ComputeListMetrics(int32 ItemCount) const;
+    FButtonSlotLayout ComputeSlotLayout(int32 ItemIndex, const FButtonListMetrics& Metrics) const;
+    void UpdateSlotPaddingsAndOffsets();
+    bool CanApplyIncrementalChange(int32 PreviousItemCount) const;
+    void UpdateButtonItems(int32 FirstIndex, TConstArrayView<FListBuildingButtonItem> InItems);
+    void ApplyIncrementalChange();
+    const FSlateBrush* GetOrCreateIconBrush(int32 ItemIndex);
+    TSharedRef<SBox> MakeButtonSlotContent(int32 ItemIndex, TSharedPtr<SIconTextButtonWidget>& OutButton);
+    void BindRealizedButton(FRealizedButton& Realized, int32 ItemIndex);
+    void ApplySlotLayout(FRealizedButton& Realized);
+    void ApplySlotPaddings();
+    void RefreshVirtualizedWindow(bool bForce);
+    void RebuildVirtualizedSlots(int32 FirstIndex, int32 LastIndex);
+    void ShiftVirtualizedSlots(int32 FirstIndex, int32 LastIndex);
+    void AcquireRealizedButton(FRealizedButton& Realized, int32 ItemIndex);
+    void InsertVirtualizedSlot(int32 SlotIndex, const FRealizedButton& Realized);
+    void ReleaseRealizedButtons();
+    void HandleButtonListScrolled(float ScrollOffset);
     bool ShouldDisplayIcon(const FSlateBrush& Brush) const;
     FOptionalSize GetButtonExtent() const;
     float GetContainerWidth() const;
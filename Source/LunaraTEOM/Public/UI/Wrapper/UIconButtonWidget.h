@@ -26,6 +26,10 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Appearance", meta = (ClampMin = 16))
     float Diameter = 64.f;
 
+    /** Stream the icon asset asynchronously and show a placeholder until it arrives, instead of loading it on the game thread. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Appearance")
+    bool bAsyncLoadIcon = false;
+
     /** Event fired when the button is clicked with a confirmed release. */
     UPROPERTY(BlueprintAssignable, Category = "Events")
     FOnIconButtonClickedBP OnClicked;
@@ -46,6 +50,14 @@ public:
     UPROPERTY(BlueprintAssignable, Category = "Events")
     FOnIconButtonUnhoveredBP OnUnhovered;
 
+    /** Starts streaming the given icons ahead of time, e.g. before opening a panel full of icon buttons. */
+    UFUNCTION(BlueprintCallable, Category = "Icon Button")
+    static void PrefetchIcons(const TArray<TSoftObjectPtr<UObject>>& Icons);
+
+    /** Lets icons kept resident by PrefetchIcons be unloaded again. */
+    UFUNCTION(BlueprintCallable, Category = "Icon Button")
+    static void ReleasePrefetchedIcons();
+
     virtual TSharedRef<SWidget> RebuildWidget() override;
     virtual void ReleaseSlateResources(bool bReleaseChildren) override;
     virtual void SynchronizeProperties() override;
@@ -26,12 +26,23 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "List Building", meta = (ExposeOnSpawn = "true"))
     FSlateFontInfo ButtonFont;
 
+    /** Only create buttons for the visible part of the list and recycle them while scrolling. Recommended for large catalogs. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "List Building|Performance")
+    bool bVirtualizeButtons = false;
+
+    /** Extra buttons kept alive on each side of the visible window when virtualized. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "List Building|Performance", meta = (ClampMin = "0", EditCondition = "bVirtualizeButtons"))
+    int32 VirtualizationOverscan = 2;
+
     UFUNCTION(BlueprintCallable, Category = "List Building")
     void SetButtonItems(const TArray<FListBuildingButtonItem>& InItems);
 
     UFUNCTION(BlueprintCallable, Category = "List Building")
     void SetButtonFont(const FSlateFontInfo& InFont);
 
+    UFUNCTION(BlueprintCallable, Category = "List Building|Performance")
+    void SetVirtualizeButtons(bool bInVirtualize, int32 InOverscan = 2);
+
     UFUNCTION(BlueprintCallable, Category = "List Building")
     void AddButtonItem(const FListBuildingButtonItem& NewItem);
 
@@ -41,6 +52,9 @@ public:
     UFUNCTION(BlueprintCallable, Category = "List Building")
     void RemoveButtonItemAt(int32 Index);
 
+    UFUNCTION(BlueprintCallable, Category = "List Building")
+    void MoveButtonItem(int32 FromIndex, int32 ToIndex);
+
     UFUNCTION(BlueprintCallable, Category = "List Building")
     void ClearButtonItems();
 